@@ -0,0 +1,45 @@
+// ===================================================================================
+// Basic Flash Functions for CH32V003                                         * v1.0 *
+// ===================================================================================
+//
+// Erases and programs the code flash at runtime, e.g. to keep game records. The
+// 64-byte pages are erased with the fast page erase. Data is programmed either as a
+// whole page with the fast page programming or half-word by half-word with standard
+// programming into erased flash.
+//
+// Functions available:
+// --------------------
+// FLASH_unlock()           Unlock flash for erasing and programming
+// FLASH_lock()             Lock flash again
+// FLASH_erase(addr)        Erase 64-byte page at addr
+// FLASH_program(addr,p,n)  Program n bytes (n even) from p to erased flash at addr
+// FLASH_page(addr,p)       Program 64-byte page at addr with 16 words from p
+//
+// Addresses are in the flash alias region (0x08000000 + offset). They must be
+// half-word aligned for FLASH_program() and page aligned for FLASH_erase() and
+// FLASH_page(). The flash region used must be kept out of the FLASH memory area in
+// the linker script.
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ch32v003.h"
+
+// Flash parameters
+#define FLASH_PAGE_SIZE   64          // fast erase page size in bytes
+#define FLASH_KEY1        0x45670123  // unlock key 1
+#define FLASH_KEY2        0xCDEF89AB  // unlock key 2
+
+// Functions
+void FLASH_unlock(void);
+void FLASH_lock(void);
+void FLASH_erase(uint32_t addr);
+void FLASH_program(uint32_t addr, const uint8_t* p, uint8_t n);
+void FLASH_page(uint32_t addr, const uint32_t* p);
+
+#ifdef __cplusplus
+};
+#endif
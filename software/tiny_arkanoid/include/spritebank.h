@@ -24,23 +24,21 @@
 extern "C" {
 #endif
 
+typedef struct BALLMOVE{
+float xpos;
+float ypos;
+float Speedx;
+float Speedy;
+int8_t AngleOut;
+}BALLMOVE;
+
 typedef struct GROUPE{
 uint8_t ANIMREFLECT;
 uint8_t launch;
-uint8_t Px;
-uint8_t Py;
 uint8_t BlocsGrid[6][5];
-float Ballxpos;
-float SIMBallxpos;
-float Ballypos;
-float SIMBallypos;
-float BallSpeedx;
-float SIMBallSpeedx;
-float BallSpeedy;
-float SIMBallSpeedy;
-int8_t TrackAngleOut;
-float Ballxposflip;
-float Ballyposflip;
+uint8_t BrickBits[6];
+uint8_t BricksLeft;
+BALLMOVE Ball;
 uint8_t BALLyDecal;
 uint8_t Ypos;
 uint8_t TrackBary;
@@ -57,6 +55,8 @@ const uint8_t  LEVEL [] = {
 0,1,2,3,4,5,5,5,5,5,5,1,2,3,4,5,1,2,3,5,5,1,2,3,4,5,1,2,3,4,5,1,2,3,5,5,1,2,3,4,
 5,5,5,5,5,0,0,0,0,0,5,5,0,5,5,5,5,0,5,5,0,0,0,0,0,5,5,5,5,5};
 
+const uint8_t  BRICKROWY [] = {8,16,23,31,40,48,55};
+
 const uint8_t  LIVE [] = {0x3E, 0x41, 0x3E};
 
 const uint8_t  BALL [] = {0x02, 0x05, 0x02};
@@ -126,71 +126,55 @@ const uint8_t  texture [] = {
 0x08,0x00,0x00,0x01,0x00,0x04,0x40,0x00,0x00,0x08,0x00,0x20,0x00,0x00,0x00
 };
 
+// 'Tiny Arkanoid Title', 128x64px, LZ packed with tools/bmppack.py
 const uint8_t  MAIN [] = {
-0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
-0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x15, 0x0A, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x32, 0x7F, 0x77, 0x63, 0x63, 0x77, 0x7F, 0x71, 0x41, 0x42, 0x5A, 0x54, 0x44, 0x48,
-0x48, 0x50, 0x50, 0x60, 0x60, 0x40, 0x00, 0x38, 0x70, 0xF4, 0xF0, 0xD0, 0xD0, 0xD0, 0xD6, 0xDA,
-0x86, 0x7C, 0xF8, 0x80, 0x00, 0xFE, 0x03, 0xC1, 0x21, 0x21, 0xA1, 0x21, 0x21, 0xC1, 0x03, 0xFE,
-0xAA, 0x05, 0x02, 0xFF, 0xFF, 0x03, 0x03, 0xC3, 0x03, 0x03, 0x03, 0x03, 0x83, 0x43, 0x43, 0x43,
-0x43, 0x83, 0x03, 0xFF, 0xFE, 0x55, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0B, 0x1B, 0x39, 0x7D, 0xF3,
-0xE1, 0xC2, 0xCC, 0x98, 0x68, 0x08, 0xC8, 0x30, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0x00,
-0x00, 0x00, 0xA1, 0xB1, 0xB1, 0xBB, 0xBB, 0xBF, 0x9F, 0x8F, 0x91, 0x91, 0xA5, 0xA5, 0xCD, 0xCD,
-0xA5, 0xA5, 0xA1, 0x91, 0x99, 0x8F, 0x00, 0x10, 0x70, 0xF0, 0xF0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
-0xD1, 0xD6, 0xD6, 0xE3, 0x00, 0xFF, 0x00, 0x07, 0x88, 0x8B, 0x88, 0x8B, 0x88, 0x07, 0x00, 0xFF,
-0xAA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00,
-0x00, 0xE7, 0x00, 0xFF, 0xFF, 0x55, 0xAA, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0x9C, 0x84, 0xC4, 0x34, 0x0C, 0x0C, 0x93, 0x60,
-0x01, 0x01, 0xC1, 0x30, 0x0C, 0x03, 0x02, 0x04, 0x18, 0x20, 0xC3, 0x0C, 0x10, 0xE0, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x10, 0x10, 0xB9, 0xB9, 0x9F, 0x9F, 0x8F, 0x8F, 0x88, 0x08, 0x12, 0x26, 0x66, 0x2A,
-0x3A, 0x12, 0x12, 0x02, 0x02, 0x03, 0x00, 0x04, 0xCC, 0xEC, 0xEC, 0xFC, 0x9C, 0xE4, 0xF4, 0xD4,
-0xCC, 0xCC, 0x8C, 0x84, 0x00, 0xFF, 0x00, 0x00, 0xA9, 0xAA, 0xBA, 0xAA, 0x91, 0x00, 0x00, 0xFF,
-0xAA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0xE1, 0x21, 0x41,
-0x41, 0x8F, 0x00, 0xFF, 0xFF, 0x55, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-0x6C, 0xD8, 0xD8, 0xD8, 0xC8, 0xE8, 0x98, 0x10, 0x3B, 0x47, 0x87, 0x07, 0x06, 0x06, 0x81, 0x60,
-0x18, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xD8, 0xBC, 0x72, 0xE2, 0xC4, 0x2D, 0x37, 0xC1, 0x00, 0x03,
-0x0C, 0x10, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0xDB, 0xDB, 0xDB, 0xD9, 0xD9, 0xD9, 0xDB, 0xDF, 0xD8, 0x51, 0x51, 0x52, 0x52, 0x54,
-0x54, 0x58, 0xD8, 0xD0, 0xD0, 0x41, 0x00, 0x71, 0x71, 0xF1, 0xE1, 0xA1, 0xA1, 0xA1, 0x21, 0x11,
-0xD1, 0xE9, 0x39, 0x1D, 0x00, 0xFF, 0x00, 0x00, 0xD4, 0x54, 0xD6, 0x55, 0xD4, 0x00, 0x00, 0xFF,
-0xAA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0xA4, 0x64, 0xE7, 0x24, 0x22,
-0x22, 0xE1, 0x00, 0xFF, 0xFF, 0x55, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x40, 0x00, 0x01, 0x21, 0x7B, 0xA7, 0x6F, 0xAF, 0x6E, 0xAC, 0x68, 0xE7, 0x98, 0x0E, 0x11, 0x20,
-0x40, 0x80, 0x00, 0x00, 0x00, 0x3D, 0xFD, 0xFB, 0xFB, 0x7A, 0xBF, 0x40, 0xC0, 0x3F, 0x80, 0x60,
-0x1C, 0x03, 0x00, 0xFF, 0x1B, 0x26, 0x0C, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x40, 0xC0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFE, 0xA3, 0xA0, 0xB8, 0xBC, 0xB4, 0xB2,
-0xB3, 0xB1, 0xB0, 0xB0, 0xA0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x01, 0x03,
-0x06, 0x04, 0x0D, 0x3E, 0x00, 0xFF, 0x00, 0x00, 0x5D, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0xFF,
-0xAA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x82,
-0x82, 0xF1, 0x00, 0xFF, 0xFF, 0x55, 0xEA, 0x00, 0x04, 0x00, 0x04, 0x2E, 0x04, 0x00, 0x04, 0x00,
-0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x06, 0x0D, 0x1A, 0x35, 0x2B, 0x56, 0xAC,
-0x58, 0xB0, 0x61, 0xB2, 0x4C, 0x83, 0x00, 0x03, 0x02, 0x05, 0x02, 0x81, 0x70, 0x0C, 0x03, 0x00,
-0xC0, 0x70, 0x8E, 0x81, 0x66, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x1E, 0xAF, 0xF1, 0xA9, 0xA9, 0xF9, 0xA9, 0xA9,
-0xF1, 0xA2, 0x02, 0x04, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x86, 0x81, 0x01, 0x01, 0x86, 0x00, 0x00, 0xFF,
-0xAA, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-0xC0, 0xC7, 0xC0, 0xFF, 0xFF, 0x55, 0xAA, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0xAA, 0x55, 0xD2, 0x01, 0x04, 0x15, 0x0A, 0x05, 0x02, 0x01, 0x84, 0x00, 0x00, 0x08, 0xC2,
+0x05, 0x02, 0xC0, 0xC0, 0x80, 0x85, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x10, 0xCE, 0x14, 0x18,
+0x32, 0x7F, 0x77, 0x63, 0x63, 0x77, 0x7F, 0x71, 0x41, 0x42, 0x5A, 0x54, 0x44, 0x48, 0x48, 0x50,
+0x50, 0x60, 0x60, 0x40, 0x00, 0x38, 0x70, 0xF4, 0xF0, 0x80, 0xD0, 0x11, 0xD6, 0xDA, 0x86, 0x7C,
+0xF8, 0x80, 0x00, 0xFE, 0x03, 0xC1, 0x21, 0x21, 0xA1, 0x21, 0x21, 0xC1, 0x03, 0xFE, 0x07, 0xAA,
+0x05, 0x02, 0xFF, 0xFF, 0x03, 0x03, 0xC3, 0x81, 0x03, 0x00, 0x83, 0x81, 0x43, 0x05, 0x83, 0x03,
+0xFF, 0xFE, 0x55, 0xAA, 0xC8, 0x61, 0x00, 0x20, 0xC4, 0x07, 0x0F, 0x0D, 0x0B, 0x1B, 0x39, 0x7D,
+0xF3, 0xE1, 0xC2, 0xCC, 0x98, 0x68, 0x08, 0xC8, 0x30, 0x60, 0x80, 0xCC, 0x1E, 0xC0, 0x00, 0x01,
+0x01, 0x00, 0xC1, 0x14, 0x17, 0xA1, 0xB1, 0xB1, 0xBB, 0xBB, 0xBF, 0x9F, 0x8F, 0x91, 0x91, 0xA5,
+0xA5, 0xCD, 0xCD, 0xA5, 0xA5, 0xA1, 0x91, 0x99, 0x8F, 0x00, 0x10, 0x70, 0xF0, 0xC1, 0x7F, 0x0B,
+0xD0, 0xD0, 0xD1, 0xD6, 0xD6, 0xE3, 0x00, 0xFF, 0x00, 0x07, 0x88, 0x8B, 0xC0, 0x01, 0x02, 0x07,
+0x00, 0xFF, 0xC0, 0x69, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x03, 0xC1, 0x44,
+0x00, 0xE7, 0xC0, 0x0F, 0xC1, 0x7F, 0x00, 0x02, 0x89, 0x00, 0x17, 0xC0, 0xF0, 0x9C, 0x84, 0xC4,
+0x34, 0x0C, 0x0C, 0x93, 0x60, 0x01, 0x01, 0xC1, 0x30, 0x0C, 0x03, 0x02, 0x04, 0x18, 0x20, 0xC3,
+0x0C, 0x10, 0xE0, 0xC1, 0x6F, 0xC2, 0x00, 0xC8, 0x2D, 0x21, 0x10, 0x10, 0xB9, 0xB9, 0x9F, 0x9F,
+0x8F, 0x8F, 0x88, 0x08, 0x12, 0x26, 0x66, 0x2A, 0x3A, 0x12, 0x12, 0x02, 0x02, 0x03, 0x00, 0x04,
+0xCC, 0xEC, 0xEC, 0xFC, 0x9C, 0xE4, 0xF4, 0xD4, 0xCC, 0xCC, 0x8C, 0x84, 0xC0, 0x7F, 0x05, 0x00,
+0xA9, 0xAA, 0xBA, 0xAA, 0x91, 0xC0, 0x7B, 0xC4, 0x7F, 0x83, 0x21, 0x04, 0xE1, 0x21, 0x41, 0x41,
+0x8F, 0xC4, 0x7F, 0xC3, 0x00, 0x01, 0x06, 0x6C, 0x80, 0xD8, 0x0D, 0xC8, 0xE8, 0x98, 0x10, 0x3B,
+0x47, 0x87, 0x07, 0x06, 0x06, 0x81, 0x60, 0x18, 0x07, 0xC0, 0x15, 0x0E, 0xE0, 0xD8, 0xBC, 0x72,
+0xE2, 0xC4, 0x2D, 0x37, 0xC1, 0x00, 0x03, 0x0C, 0x10, 0xE0, 0x80, 0xC2, 0x29, 0x00, 0x01, 0xC0,
+0x03, 0x00, 0x40, 0xC1, 0x08, 0x80, 0xDB, 0x80, 0xD9, 0x12, 0xDB, 0xDF, 0xD8, 0x51, 0x51, 0x52,
+0x52, 0x54, 0x54, 0x58, 0xD8, 0xD0, 0xD0, 0x41, 0x00, 0x71, 0x71, 0xF1, 0xE1, 0x80, 0xA1, 0x05,
+0x21, 0x11, 0xD1, 0xE9, 0x39, 0x1D, 0xC1, 0x7F, 0x04, 0xD4, 0x54, 0xD6, 0x55, 0xD4, 0xC0, 0x7B,
+0xC4, 0x7F, 0x81, 0x24, 0x06, 0xA4, 0x64, 0xE7, 0x24, 0x22, 0x22, 0xE1, 0xC1, 0x7F, 0x00, 0xEA,
+0xC1, 0x48, 0xC2, 0x57, 0x10, 0x40, 0x00, 0x01, 0x21, 0x7B, 0xA7, 0x6F, 0xAF, 0x6E, 0xAC, 0x68,
+0xE7, 0x98, 0x0E, 0x11, 0x20, 0x40, 0xC1, 0x15, 0x12, 0x3D, 0xFD, 0xFB, 0xFB, 0x7A, 0xBF, 0x40,
+0xC0, 0x3F, 0x80, 0x60, 0x1C, 0x03, 0x00, 0xFF, 0x1B, 0x26, 0x0C, 0x10, 0xC3, 0x7B, 0xC2, 0x31,
+0x12, 0xC0, 0xE0, 0xF0, 0xF0, 0xFC, 0xFC, 0xFE, 0xA3, 0xA0, 0xB8, 0xBC, 0xB4, 0xB2, 0xB3, 0xB1,
+0xB0, 0xB0, 0xA0, 0xE0, 0xC3, 0x19, 0x07, 0x04, 0x01, 0x01, 0x03, 0x06, 0x04, 0x0D, 0x3E, 0xC1,
+0x7F, 0x00, 0x5D, 0x80, 0x04, 0x00, 0x05, 0xC0, 0x7B, 0xC4, 0x7F, 0x80, 0x82, 0x03, 0x81, 0x80,
+0x80, 0x81, 0xC0, 0x06, 0x00, 0xF1, 0xC3, 0x7F, 0x03, 0x04, 0x00, 0x04, 0x2E, 0xC0, 0x03, 0xC4,
+0x56, 0xC1, 0x38, 0x1B, 0x0D, 0x1A, 0x35, 0x2B, 0x56, 0xAC, 0x58, 0xB0, 0x61, 0xB2, 0x4C, 0x83,
+0x00, 0x03, 0x02, 0x05, 0x02, 0x81, 0x70, 0x0C, 0x03, 0x00, 0xC0, 0x70, 0x8E, 0x81, 0x66, 0x18,
+0x89, 0x00, 0x01, 0xF0, 0xF8, 0xC0, 0x7C, 0x0E, 0xFE, 0x1E, 0xAF, 0xF1, 0xA9, 0xA9, 0xF9, 0xA9,
+0xA9, 0xF1, 0xA2, 0x02, 0x04, 0x08, 0xF0, 0xC3, 0x44, 0xC3, 0x1F, 0x00, 0x10, 0xC0, 0x71, 0x06,
+0x00, 0x00, 0x86, 0x81, 0x01, 0x01, 0x86, 0xC0, 0x09, 0xC0, 0x7F, 0x01, 0x7F, 0xFF, 0x89, 0xC0,
+0x01, 0xC7, 0xC0, 0xC0, 0x7F, 0x02, 0xAA, 0x00, 0x20, 0xC9, 0x52, 0xC0, 0x32, 0xC5, 0x00, 0x12,
 0x01, 0x02, 0x05, 0x06, 0x0D, 0x1A, 0x35, 0x5A, 0x74, 0xD8, 0xB6, 0x59, 0xA8, 0xC4, 0x82, 0x03,
-0x07, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x21, 0x23, 0x27, 0x67, 0xE7, 0xEF, 0xFF, 0xFE, 0xB1, 0xB2, 0xB2, 0xB3, 0xB2, 0xB2,
-0xB1, 0xA8, 0xA8, 0xA4, 0xA3, 0xE0, 0x00, 0x00, 0x04, 0x10, 0x00, 0x10, 0xBA, 0x10, 0x00, 0x10,
-0x00, 0x00, 0x08, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x93, 0xA8, 0xA9, 0xAA, 0x91, 0x00, 0x00, 0xFF,
-0xAA, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54, 0xA8, 0x54,
-0xA8, 0x54, 0xA8, 0x54, 0xAA, 0x55, 0xAA, 0x50, 0xA0, 0x40, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x04, 0x01, 0x03,
-0x02, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x11, 0x11, 0x21, 0x25, 0x4D, 0x45,
-0xD5, 0xD5, 0x4D, 0x4D, 0x21, 0x23, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x02, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x80, 0x8C, 0x92, 0x8C, 0x92, 0x8C, 0x80, 0xC0, 0x7F
+0x07, 0x03, 0x02, 0xC4, 0x57, 0x01, 0x00, 0x08, 0xC3, 0x06, 0x1A, 0x21, 0x23, 0x27, 0x67, 0xE7,
+0xEF, 0xFF, 0xFE, 0xB1, 0xB2, 0xB2, 0xB3, 0xB2, 0xB2, 0xB1, 0xA8, 0xA8, 0xA4, 0xA3, 0xE0, 0x00,
+0x00, 0x04, 0x10, 0x00, 0x10, 0xBA, 0xC0, 0x03, 0xC2, 0x26, 0xC0, 0x7F, 0x04, 0x93, 0xA8, 0xA9,
+0xAA, 0x91, 0xC0, 0x09, 0x02, 0xAA, 0x54, 0xA8, 0xCE, 0x01, 0x06, 0xAA, 0x55, 0xAA, 0x50, 0xA0,
+0x40, 0x80, 0xC4, 0x4F, 0xCD, 0x00, 0xC0, 0x42, 0xC2, 0x00, 0x03, 0x01, 0x03, 0x02, 0x04, 0xC0,
+0x03, 0xC9, 0x12, 0xC3, 0x17, 0x13, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x11, 0x11, 0x21,
+0x25, 0x4D, 0x45, 0xD5, 0xD5, 0x4D, 0x4D, 0x21, 0x23, 0x1E, 0xC1, 0x18, 0x00, 0x80, 0xC2, 0x1E,
+0xC1, 0x30, 0x04, 0x7F, 0xC0, 0x80, 0x8C, 0x92, 0xC0, 0x01, 0x02, 0x80, 0xC0, 0x7F
 };
 
 #ifdef __cplusplus
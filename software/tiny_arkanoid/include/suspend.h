@@ -0,0 +1,70 @@
+// ===================================================================================
+// Suspend to Flash for CH32V003                                              * v1.0 *
+// ===================================================================================
+//
+// Saves the state of a running game to the code flash, so that it can be resumed
+// after a power down. The state is transferred as a list of variables between
+// SUSPEND_begin() and SUSPEND_end(). The same list is used for saving and for
+// loading, so a game keeps a single function that names its state once:
+//
+//   uint8_t State(uint8_t mode) {
+//     if(!SUSPEND_begin(mode, GAME_ID)) return 0;
+//     SUSPEND_var(level);
+//     SUSPEND_var(player);
+//     return SUSPEND_end();
+//   }
+//
+// The image is written with the 64-byte fast page programming behind a header page
+// with the game ID, the image length and a CRC-16. The header is erased first and
+// written last, so a power loss while saving leaves no image instead of a broken
+// one. Loading erases the header again, so an image is resumed only once.
+//
+// Functions available:
+// --------------------
+// SUSPEND_begin(mode, id)  Start saving (SUSPEND_SAVE) or loading (SUSPEND_LOAD)
+//                          the image of game id, returns 0 if there is no valid
+//                          image to load
+// SUSPEND_var(v)           Save or load variable v
+// SUSPEND_xfer(p, n)       Save or load n bytes at p
+// SUSPEND_end()            Finish saving or loading, returns 0 if the image could
+//                          not be written or does not match the loaded variables
+//
+// The SUSPEND_PAGES pages at SUSPEND_ADDR must be kept out of the FLASH memory area
+// in the linker script.
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "flash.h"
+
+// Image parameters
+#ifndef SUSPEND_ADDR
+#define SUSPEND_ADDR      0x08003D00  // start of image (512 bytes below the store)
+#endif
+#define SUSPEND_PAGES     8           // number of 64-byte pages incl. header page
+#define SUSPEND_MAGIC     0x5A        // marks a written image
+#define SUSPEND_SAVE      0           // mode: write state to flash
+#define SUSPEND_LOAD      1           // mode: read state from flash
+
+// Header, first page of the image
+typedef struct SUSPEND_head {
+  uint8_t  magic;                 // SUSPEND_MAGIC
+  uint8_t  id;                    // game ID
+  uint16_t len;                   // number of bytes in the data pages
+  uint16_t crc;                   // CRC-16 over the data bytes
+} SUSPEND_head;
+
+// Functions
+uint8_t SUSPEND_begin(uint8_t mode, uint8_t id);
+void SUSPEND_xfer(void* p, uint16_t n);
+uint8_t SUSPEND_end(void);
+
+#define SUSPEND_var(v)    SUSPEND_xfer(&(v), sizeof(v))
+
+#ifdef __cplusplus
+};
+#endif
@@ -29,6 +29,25 @@
 #include "driver.h"
 #include "spritebank.h"
 
+#define RENDER_DIRTY 1        // 0: full redraw every 32 frames, 1: redraw what moved every frame
+#define SHOW_FPS 0            // 1: the level panel shows the frames rendered per second
+#define BALLSTEPMAX 1         // longest ball sub-step per axis in pixels, see UpdateBall
+
+#if SHOW_FPS == 1
+#define PANNELVALUE ((JOY_fps>99)?99:JOY_fps)
+#else
+#define PANNELVALUE (VAR->LEVEL)
+#endif
+
+#if RENDER_DIRTY == 1
+uint8_t DrawnValid = 0;       // the screen shows the state below
+int8_t DrawnBallX;            // ball center column, negative when the ball is lost
+uint8_t DrawnBallY, DrawnBallDecal, DrawnBallRow; // page, shift and top row of the ball
+uint8_t DrawnTrack;           // trackbar top in pixels
+uint8_t DrawnAnim, DrawnLive, DrawnPannel;
+uint8_t DrawnBricks[6];       // brick bitmap of each row
+#endif
+
 // ===================================================================================
 // Function Prototypes
 // ===================================================================================
@@ -36,18 +55,20 @@ void RsVarNewGame(GROUPE *VAR);
 void PLAYMUSIC(void);
 uint8_t BallMissing(GROUPE *VAR);
 uint8_t CheckLevelEnded(GROUPE *VAR);
-void UpdateBall(GROUPE *VAR);
-void RecupeBALLPosForSIM(GROUPE *VAR);
-void TestMoveBALL(GROUPE *VAR);
-void SimulMove(uint8_t Sim,GROUPE *VAR);
-uint8_t CheckCollisionBall(GROUPE *VAR);
-uint8_t CheckCollisionWithBLOCK(GROUPE *VAR);
-void RecupePositionOnGrid(GROUPE *VAR);
-uint8_t RecupeXPositionOnGrid(GROUPE *VAR);
-uint8_t RecupeYPositionOnGrid(GROUPE *VAR);
-uint8_t CheckCollisionWithTRACKBAR(GROUPE *VAR);
-void WriteBallMove(GROUPE *VAR);
+void UpdateBall(BALLMOVE *B,GROUPE *VAR);
+void MoveBall(BALLMOVE *B,uint8_t n,GROUPE *VAR);
+uint8_t CheckCollisionBall(float X,float Y,uint8_t HIT,BALLMOVE *B,GROUPE *VAR);
+uint8_t CheckCollisionWithBLOCK(float X,float Y,uint8_t HIT,GROUPE *VAR);
+uint8_t RecupeXPositionOnGrid(float X);
+uint8_t RecupeYPositionOnGrid(float Y);
+uint8_t CheckCollisionWithTRACKBAR(float X,float Y,uint8_t HIT,BALLMOVE *B,GROUPE *VAR);
+void WriteBallMove(BALLMOVE *B,GROUPE *VAR);
+uint8_t ScreenByte(uint8_t X,uint8_t Y,GROUPE *VAR);
 void Tiny_Flip(uint8_t render0_picture1,GROUPE *VAR);
+void Tiny_Window(uint8_t x0,uint8_t y0,uint8_t x1,uint8_t y1,GROUPE *VAR);
+uint8_t Tiny_Update(GROUPE *VAR);
+void Tiny_Drawn(GROUPE *VAR);
+int8_t BallColumn(GROUPE *VAR);
 uint8_t PannelLevel(uint8_t X,uint8_t Y,GROUPE *VAR);
 uint8_t Block(uint8_t X,uint8_t Y,GROUPE *VAR);
 uint8_t RecupeDecalageY(uint8_t Valeur);
@@ -59,6 +80,7 @@ uint8_t background(uint8_t X,uint8_t Y);
 void LoadLevel(uint8_t Level,GROUPE *VAR);
 void ResetVar(GROUPE *VAR);
 void ResetBall(GROUPE *VAR);
+uint8_t SuspendGame(uint8_t mode,GROUPE *VAR);
 
 // ===================================================================================
 // Main Function
@@ -70,6 +92,10 @@ int main(void) {
 // Loop
   while(1) {
     GROUPE VARIABLE;
+    if(SuspendGame(SUSPEND_LOAD, &VARIABLE)) {
+      Tiny_Flip(0, &VARIABLE);
+      goto RESUME;
+    }
   NEWGAME:
     Tiny_Flip(1, &VARIABLE);
     while(!JOY_act_pressed());
@@ -99,6 +125,7 @@ int main(void) {
     else goto NEWGAME;
   ONE:
     ResetBall(&VARIABLE);
+  RESUME:
     while(1) {
       if(VARIABLE.Frame % 8 == 0) {
         if(JOY_down_pressed()) {
@@ -125,12 +152,18 @@ int main(void) {
         }
         if((VARIABLE.launch == 0) && (JOY_act_pressed())) VARIABLE.launch = 1;
         if(VARIABLE.launch == 0) {
-          VARIABLE.Ballypos = ((VARIABLE.TrackBary * 8) + VARIABLE.TrackBaryDecal) + 10;
-          VARIABLE.SIMBallypos = VARIABLE.Ballypos;
+          VARIABLE.Ball.ypos = ((VARIABLE.TrackBary * 8) + VARIABLE.TrackBaryDecal) + 10;
         }
       }
-      if((VARIABLE.Frame%VARIABLE.LEVELSPEED == 0)) UpdateBall(&VARIABLE);
-      if(VARIABLE.Frame % 32 == 0) Tiny_Flip(0, &VARIABLE);
+      if((VARIABLE.Frame%VARIABLE.LEVELSPEED == 0)) UpdateBall(&VARIABLE.Ball,&VARIABLE);
+      #if RENDER_DIRTY == 1
+      if(Tiny_Update(&VARIABLE)) JOY_fps_count();
+      #else
+      if(VARIABLE.Frame % 32 == 0) {
+        Tiny_Flip(0, &VARIABLE);
+        JOY_fps_count();
+      }
+      #endif
       if(VARIABLE.Frame == 48) {
         if(VARIABLE.ANIMREFLECT < 3) VARIABLE.ANIMREFLECT++;
         if(BallMissing(&VARIABLE)) goto RESTARTLEVEL;
@@ -138,6 +171,10 @@ int main(void) {
       }
       if(VARIABLE.Frame < 64) VARIABLE.Frame++;
       else VARIABLE.Frame = 1;
+      if(JOY_suspend_due()) {
+        SuspendGame(SUSPEND_SAVE, &VARIABLE);
+        JOY_sleep();
+      }
       JOY_SLOWDOWN();
     }
   }
@@ -146,6 +183,12 @@ int main(void) {
 // ===================================================================================
 // Functions
 // ===================================================================================
+uint8_t SuspendGame(uint8_t mode,GROUPE *VAR){
+if (!SUSPEND_begin(mode,'A')) return 0;
+SUSPEND_var(*VAR);
+return SUSPEND_end();
+}
+
 void RsVarNewGame(GROUPE *VAR){
 VAR->LEVELSPEED=16;
 VAR->LEVEL=1;
@@ -160,140 +203,218 @@ JOY_sound((Music1[t]),((Music1[t+1])-100));
 }}
 
 uint8_t BallMissing(GROUPE *VAR){
-if (VAR->Ballxpos<0) {return 1;}
+if (VAR->Ball.xpos<0) {return 1;}
 return 0; 
 }
 
 uint8_t CheckLevelEnded(GROUPE *VAR){
-uint8_t h,v,res=1;
-for(v=0;v<5;v++){
-for(h=0;h<6;h++){
-if ((VAR->BlocsGrid[h][v]!=255)&&(VAR->BlocsGrid[h][v]!=5)) {res=0;}
-}}
-return res;
+return (VAR->BricksLeft==0);
 }
 
-void UpdateBall(GROUPE *VAR){
-VAR->TrackAngleOut=0;
-for (uint8_t T1=0;T1<=6;T1++) {
-RecupeBALLPosForSIM(VAR);
+// moves the ball B one step. The step is swept in sub-steps of at most
+// BALLSTEPMAX pixel per axis, the width of the trackbar window (X 5..6) and the
+// thinnest obstacle, so no sub-step can pass through the trackbar, a brick (6
+// pixels wide, rows at least 7 high) or a wall. At the speeds of the game
+// (|Speedx| 1, |Speedy| clamped to 1 in WriteBallMove) a step is one sub-step.
+// Bricks, trackbar and walls are shared, everything of the ball is in B.
+void UpdateBall(BALLMOVE *B,GROUPE *VAR){
+uint8_t n=1,i;
+B->AngleOut=0;
 if (VAR->launch==0) goto FIN;
-SimulMove(T1,VAR);
-TestMoveBALL(VAR);
-if (CheckCollisionBall(VAR)==0) {goto FIN;}
-}
+while ((abs(B->Speedx)>n*BALLSTEPMAX)||(abs(B->Speedy)>n*BALLSTEPMAX)) {n++;}
+for (i=0;i<n;i++) {MoveBall(B,n,VAR);}
 FIN:;
-WriteBallMove(VAR);
-}
-
-void RecupeBALLPosForSIM(GROUPE *VAR){
-VAR->SIMBallxpos=VAR->Ballxpos;
-VAR->SIMBallypos=VAR->Ballypos;
-VAR->SIMBallSpeedx=VAR->BallSpeedx;
-VAR->SIMBallSpeedy=VAR->BallSpeedy;
+WriteBallMove(B,VAR);
 }
 
-void TestMoveBALL(GROUPE *VAR){
-VAR->SIMBallxpos=VAR->SIMBallxpos+VAR->SIMBallSpeedx;
-VAR->SIMBallypos=VAR->SIMBallypos+VAR->SIMBallSpeedy;
+// moves the ball B by 1/n of its speed, the x and the y move are tested
+// separately against walls, trackbar and brick bitmap, a blocked axis is
+// reflected, a blocked corner reflects both
+void MoveBall(BALLMOVE *B,uint8_t n,GROUPE *VAR){
+float X,Y,SX=B->Speedx,SY=B->Speedy;
+uint8_t HX,HY;
+if (n>1) {SX=SX/n;SY=SY/n;}
+X=B->xpos+SX;
+Y=B->ypos+SY;
+HX=CheckCollisionBall(X,B->ypos,1,B,VAR);
+HY=CheckCollisionBall(B->xpos,Y,1,B,VAR);
+if ((HX==0)&&(HY==0)&&(CheckCollisionBall(X,Y,1,B,VAR))) {HX=1;HY=1;}
+if (HX) {B->Speedx=-B->Speedx;SX=-SX;}
+if (HY) {B->Speedy=-B->Speedy;SY=-SY;}
+X=B->xpos+SX;
+Y=B->ypos+SY;
+if ((HX||HY)&&(CheckCollisionBall(X,Y,0,B,VAR))) return;
+B->xpos=X;
+B->ypos=Y;
 }
 
-void SimulMove(uint8_t Sim,GROUPE *VAR){
-switch(Sim){
-  case (0):VAR->SIMBallSpeedx=VAR->BallSpeedx;VAR->SIMBallSpeedy=VAR->BallSpeedy;break;
-  case (1):VAR->SIMBallSpeedx=-VAR->BallSpeedx;VAR->SIMBallSpeedy=VAR->BallSpeedy;break;
-  case (2):VAR->SIMBallSpeedx=VAR->BallSpeedx;VAR->SIMBallSpeedy=-VAR->BallSpeedy;break;
-  case (3):VAR->SIMBallSpeedx=-VAR->BallSpeedx;VAR->SIMBallSpeedy=-VAR->BallSpeedy;break;
-  case (4):VAR->SIMBallSpeedx=-VAR->BallSpeedy;VAR->SIMBallSpeedy=-VAR->BallSpeedx;break;
-  case (5):VAR->SIMBallxpos=VAR->Ballxpos+1;VAR->SIMBallypos=VAR->Ballypos;VAR->SIMBallSpeedx=-1;VAR->SIMBallSpeedy=1;break;
-  case (6):VAR->SIMBallxpos=VAR->Ballxpos+1;VAR->SIMBallypos=VAR->Ballypos;VAR->SIMBallSpeedx=-1;VAR->SIMBallSpeedy=-1;break;
-  default:break;
-}}
-
-uint8_t CheckCollisionBall(GROUPE *VAR){
-if (VAR->SIMBallxpos>106) {return 1;}
-if (VAR->SIMBallypos>59) {return 1;}
-if (VAR->SIMBallypos<4) {return 1;}
-if (CheckCollisionWithTRACKBAR(VAR)) {JOY_sound(60,10);return 1;}
-if (CheckCollisionWithBLOCK(VAR)) {return 1;}
+uint8_t CheckCollisionBall(float X,float Y,uint8_t HIT,BALLMOVE *B,GROUPE *VAR){
+if (X>106) {return 1;}
+if (Y>59) {return 1;}
+if (Y<4) {return 1;}
+if (CheckCollisionWithTRACKBAR(X,Y,HIT,B,VAR)) {return 1;}
+if (CheckCollisionWithBLOCK(X,Y,HIT,VAR)) {return 1;}
 return 0;
 }
 
-uint8_t CheckCollisionWithBLOCK(GROUPE *VAR){
-RecupePositionOnGrid(VAR);
-if ((VAR->Px==255)||(VAR->Py==255)) {return 0;}
-if (VAR->BlocsGrid[VAR->Py][VAR->Px]==5) {JOY_sound(210,50);VAR->ANIMREFLECT=0;return 1;}
-if (VAR->BlocsGrid[VAR->Py][VAR->Px]==255) {return 0;}
+uint8_t CheckCollisionWithBLOCK(float X,float Y,uint8_t HIT,GROUPE *VAR){
+uint8_t Px=RecupeXPositionOnGrid(X);
+uint8_t Py=RecupeYPositionOnGrid(Y);
+if ((Px==255)||(Py==255)) {return 0;}
+if ((VAR->BrickBits[Py]&(1<<Px))==0) {return 0;}
+if (HIT==0) {return 1;}
+if (VAR->BlocsGrid[Py][Px]==5) {JOY_sound(210,50);VAR->ANIMREFLECT=0;return 1;}
 JOY_sound(150,10);
-VAR->BlocsGrid[VAR->Py][VAR->Px]=255;
+VAR->BlocsGrid[Py][Px]=255;
+VAR->BrickBits[Py]&=~(1<<Px);
+VAR->BricksLeft--;
 return 1;
 }
 
-void RecupePositionOnGrid(GROUPE *VAR){
-VAR->Px=RecupeXPositionOnGrid(VAR);
-VAR->Py=RecupeYPositionOnGrid(VAR);
-}
-
-uint8_t RecupeXPositionOnGrid(GROUPE *VAR){
-if ((VAR->SIMBallxpos>=66)&&(VAR->SIMBallxpos<72))  return 0;
-else if ((VAR->SIMBallxpos>=72)&&(VAR->SIMBallxpos<78)) return 1;
-else if ((VAR->SIMBallxpos>=78)&&(VAR->SIMBallxpos<84)) return 2;
-else if ((VAR->SIMBallxpos>=84)&&(VAR->SIMBallxpos<90))  return 3;
-else if ((VAR->SIMBallxpos>=90)&&(VAR->SIMBallxpos<96))  return 4;  
-return 255;
+uint8_t RecupeXPositionOnGrid(float X){
+uint8_t Px=0,XX;
+if ((X<66)||(X>=96)) return 255;
+XX=(uint8_t)X-66;
+while(XX>=6){XX=XX-6;Px++;}
+return Px;
 }
 
-uint8_t RecupeYPositionOnGrid(GROUPE *VAR){
-if ((VAR->SIMBallypos>=8)&&(VAR->SIMBallypos<16)) return 0;
-else if ((VAR->SIMBallypos>=16)&&(VAR->SIMBallypos<23))  return 1;
-else if ((VAR->SIMBallypos>=23)&&(VAR->SIMBallypos<31))  return 2;
-else if ((VAR->SIMBallypos>=31)&&(VAR->SIMBallypos<40))  return 3;
-else if ((VAR->SIMBallypos>=40)&&(VAR->SIMBallypos<48))  return 4; 
-else if ((VAR->SIMBallypos>=48)&&(VAR->SIMBallypos<55))  return 5;   
-return 255;
+uint8_t RecupeYPositionOnGrid(float Y){
+uint8_t Py=0;
+if ((Y<BRICKROWY[0])||(Y>=BRICKROWY[6])) return 255;
+while(Y>=BRICKROWY[Py+1]){Py++;}
+return Py;
 }
 
-uint8_t CheckCollisionWithTRACKBAR(GROUPE *VAR){
+uint8_t CheckCollisionWithTRACKBAR(float X,float Y,uint8_t HIT,BALLMOVE *B,GROUPE *VAR){
 uint8_t TRACK=(VAR->TrackBary*8)+VAR->TrackBaryDecal;
-if ((VAR->SIMBallxpos>6)||(VAR->SIMBallxpos<5)) {return 0;}
-if (TRACK>VAR->SIMBallypos) {return 0;}
-if ((TRACK+16)<VAR->SIMBallypos) {return 0;}
-VAR->TrackAngleOut=(((VAR->SIMBallypos-TRACK)*200)/16)-100;
+if ((X>6)||(X<5)) {return 0;}
+if (TRACK>Y) {return 0;}
+if ((TRACK+16)<Y) {return 0;}
+if (HIT) {B->AngleOut=(((Y-TRACK)*200)/16)-100;JOY_sound(60,10);}
 return 1;
 }
 
-void WriteBallMove(GROUPE *VAR){
-float CORECTIONY=(VAR->SIMBallSpeedy)+(VAR->TrackAngleOut/100.00);
-if (CORECTIONY<-1) {CORECTIONY=-1;}
-if (CORECTIONY>1) {CORECTIONY=1;}
-VAR->Ballxpos=VAR->SIMBallxpos;
-VAR->Ballypos=VAR->SIMBallypos;
-VAR->BallSpeedx=VAR->SIMBallSpeedx;
-VAR->BallSpeedy=CORECTIONY;
-VAR->BALLyDecal=RecupeDecalageY(VAR->Ballypos-1);
-VAR->Ypos=((VAR->Ballypos-1)/8);
+void WriteBallMove(BALLMOVE *B,GROUPE *VAR){
+float CORECTIONY=(B->Speedy)+(B->AngleOut/100.00);
+if (CORECTIONY<-BALLSTEPMAX) {CORECTIONY=-BALLSTEPMAX;}
+if (CORECTIONY>BALLSTEPMAX) {CORECTIONY=BALLSTEPMAX;}
+B->Speedy=CORECTIONY;
+VAR->BALLyDecal=RecupeDecalageY(B->ypos-1);
+VAR->Ypos=((B->ypos-1)/8);
+}
+
+uint8_t ScreenByte(uint8_t X,uint8_t Y,GROUPE *VAR){
+return (Block(X,Y,VAR)|Ball(X,Y,VAR)|TrackBar(X,Y,VAR)|background(X,Y)|PannelLive(X,Y,VAR)|PannelLevel(X,Y,VAR));
 }
 
 void Tiny_Flip(uint8_t render0_picture1,GROUPE *VAR){
   uint8_t y,x; 
+  #if RENDER_DIRTY == 1
+  DrawnValid=0;
+  #endif
+  if(render0_picture1==1) {
+    JOY_OLED_draw_packed(MAIN);
+    return;
+  }
   for(y = 0; y < 8; y++) { 
     JOY_OLED_data_start(y);
     for(x = 0; x < 128; x++) {
       if(render0_picture1==0)
-        JOY_OLED_send(Block(x,y,VAR)|Ball(x,y,VAR)|TrackBar(x,y,VAR)|background(x,y)|PannelLive(x,y,VAR)|PannelLevel(x,y,VAR));
-      else if(render0_picture1==1)
-        JOY_OLED_send((MAIN[x+(y*128)]));
+        JOY_OLED_send(ScreenByte(x,y,VAR));
       else if(render0_picture1==2)
         JOY_OLED_send(background(x,y));
     }
     JOY_OLED_end();
   }
+  #if RENDER_DIRTY == 1
+  if(render0_picture1==0) Tiny_Drawn(VAR);
+  #endif
+}
+
+#if RENDER_DIRTY == 1
+// sends the rectangle of columns x0..x1 and pages y0..y1 through an OLED window
+void Tiny_Window(uint8_t x0,uint8_t y0,uint8_t x1,uint8_t y1,GROUPE *VAR){
+  uint8_t y,x;
+  if(x1>127) x1=127;
+  if(y1>7) y1=7;
+  JOY_OLED_data_start_window(x0,y0,x1,y1);
+  for(y = y0; y <= y1; y++) {
+    for(x = x0; x <= x1; x++) JOY_OLED_send(ScreenByte(x,y,VAR));
+  }
+  JOY_OLED_end();
+}
+
+// redraws what changed since the last frame: the box around the old and the
+// new ball, the trackbar column, the brick rows and the level panel. A lost
+// live redraws the whole screen. Returns 1 if anything was sent.
+uint8_t Tiny_Update(GROUPE *VAR){
+  int8_t x;
+  uint8_t r,b,y,t,sent=0;
+  if((!DrawnValid)||(DrawnLive!=VAR->live)) {
+    Tiny_Flip(0,VAR);
+    return 1;
+  }
+  x=BallColumn(VAR);
+  y=VAR->Ypos;
+  if((x!=DrawnBallX)||(y!=DrawnBallY)||(VAR->BALLyDecal!=DrawnBallDecal)||((uint8_t)(VAR->Ball.ypos-1)!=DrawnBallRow)) {
+    int8_t x0=((x<DrawnBallX)?x:DrawnBallX)-1;
+    int8_t x1=((x>DrawnBallX)?x:DrawnBallX)+1;
+    if(x1>=0) {
+      Tiny_Window((x0<0)?0:x0,(y<DrawnBallY)?y:DrawnBallY,x1,((y>DrawnBallY)?y:DrawnBallY)+1,VAR);
+      sent=1;
+    }
+  }
+  t=(VAR->TrackBary*8)+VAR->TrackBaryDecal;
+  if(t!=DrawnTrack) {
+    Tiny_Window(3,((t<DrawnTrack)?t:DrawnTrack)/8,6,(((t>DrawnTrack)?t:DrawnTrack)/8)+2,VAR);
+    sent=1;
+  }
+  for(r=0;r<6;r++) {
+    uint8_t dirty=(VAR->BrickBits[r]!=DrawnBricks[r]);
+    if(VAR->ANIMREFLECT!=DrawnAnim) {
+      for(b=0;b<5;b++) if(VAR->BlocsGrid[r][b]==5) dirty=1;
+    }
+    if(dirty) {
+      Tiny_Window(67,r+1,96,r+1,VAR);
+      sent=1;
+    }
+  }
+  if(PANNELVALUE!=DrawnPannel) {
+    Tiny_Window(117,5,123,6,VAR);
+    sent=1;
+  }
+  if(sent) JOY_OLED_window_full();
+  Tiny_Drawn(VAR);
+  return sent;
+}
+
+// remembers the state the screen shows
+void Tiny_Drawn(GROUPE *VAR){
+  uint8_t r;
+  DrawnBallX=BallColumn(VAR);
+  DrawnBallY=VAR->Ypos;
+  DrawnBallDecal=VAR->BALLyDecal;
+  DrawnBallRow=(uint8_t)(VAR->Ball.ypos-1);
+  DrawnTrack=(VAR->TrackBary*8)+VAR->TrackBaryDecal;
+  DrawnAnim=VAR->ANIMREFLECT;
+  DrawnLive=VAR->live;
+  DrawnPannel=PANNELVALUE;
+  for(r=0;r<6;r++) DrawnBricks[r]=VAR->BrickBits[r];
+  DrawnValid=1;
+}
+#endif
+
+// center column of the ball sprite, the sprite covers one column on each side
+int8_t BallColumn(GROUPE *VAR){
+if (VAR->Ball.xpos<-100) return -100;
+return (int8_t)(VAR->Ball.xpos);
 }
 
 uint8_t PannelLevel(uint8_t X,uint8_t Y,GROUPE *VAR){
 if ((Y<5)||(Y>6)||(X<117)||(X>123)) return 0x00;
-#define VAl10 (VAR->LEVEL/10)
-#define VAl01 (VAR->LEVEL-(VAl10*10))
+#define VAl10 (PANNELVALUE/10)
+#define VAl01 (PANNELVALUE-(VAl10*10))
 if (Y==5) {return ((DIGITAL[(X-117)+(VAl10*7)]));}
 else if (Y==6) {return ((DIGITAL[(X-117)+(VAl01*7)]));}
 return 0x00;
@@ -320,8 +441,8 @@ return Valeur;
 }
 
 uint8_t Ball(uint8_t X,uint8_t Y,GROUPE *VAR){
-#define BALLXPOS (VAR->Ballxpos-1)
-#define BALLYPOS (VAR->Ballypos-1)
+#define BALLXPOS (VAR->Ball.xpos-1)
+#define BALLYPOS (VAR->Ball.ypos-1)
  if (Y<VAR->Ypos) return 0x00;
  if (Y>(VAR->Ypos+1)) return 0x00;
  if ((X-(uint8_t)(BALLXPOS))<0) return 0x00;
@@ -358,11 +479,10 @@ uint8_t PannelLive(uint8_t X,uint8_t Y,GROUPE *VAR){
 if ((Y<1)||(Y>VAR->live)||(X>121)||(X<119)) return 0x00;
 return ((LIVE[X-119]));}
 
-uint8_t SWIFT_TEXTURE=0;
 uint8_t background(uint8_t X,uint8_t Y){ 
-if (X==0) SWIFT_TEXTURE=0;
+uint8_t SWIFT_TEXTURE=X+1;
 if (X<=105){
-if (SWIFT_TEXTURE<14) {SWIFT_TEXTURE++;}else{SWIFT_TEXTURE=0;}
+while(SWIFT_TEXTURE>14){SWIFT_TEXTURE=SWIFT_TEXTURE-15;}
 switch(Y){
   case 0:return ((back_UP[X]));break;
   case 1:
@@ -383,9 +503,13 @@ return 0x00;
 
 void LoadLevel(uint8_t Level,GROUPE *VAR){
 uint8_t a,b;
-for(b=0;b<5;b++){
+VAR->BricksLeft=0;
 for(a=0;a<6;a++){
+VAR->BrickBits[a]=0;
+for(b=0;b<5;b++){
 VAR->BlocsGrid[a][b]=(LEVEL[(Level*30)+b+(a*5)]);
+if (VAR->BlocsGrid[a][b]!=255) VAR->BrickBits[a]|=(1<<b);
+if ((VAR->BlocsGrid[a][b]!=255)&&(VAR->BlocsGrid[a][b]!=5)) VAR->BricksLeft++;
 }}}
 
 void ResetVar(GROUPE *VAR){
@@ -398,18 +522,13 @@ void ResetBall(GROUPE *VAR){
 VAR->ANIMREFLECT=0;
 VAR->TrackBary=2;
 VAR->TrackBaryDecal=4;
-VAR->Ballxpos=8;
-VAR->SIMBallxpos=8;
-VAR->Ballypos=32;
-VAR->SIMBallypos=32;
-VAR->BallSpeedx=1;
-VAR->SIMBallSpeedx=1;
+VAR->Ball.xpos=8;
+VAR->Ball.ypos=32;
+VAR->Ball.Speedx=1;
 if (VAR->Frame>32) {
-VAR->BallSpeedy=.41;
-VAR->SIMBallSpeedy=.41;
+VAR->Ball.Speedy=.41;
 }else{
-VAR->BallSpeedy=.47;
-VAR->SIMBallSpeedy=.47;  
+VAR->Ball.Speedy=.47;
 }
 VAR->launch=0;
 }
@@ -0,0 +1,69 @@
+// ===================================================================================
+// Record Log in Flash for CH32V003                                           * v1.0 *
+// ===================================================================================
+//
+// Keeps small records (e.g. high scores) in the last pages of the code flash. The
+// log is append-only: every write goes to the next slot after the newest record,
+// so the pages wear evenly and a page is only erased when the log enters it. Each
+// record carries a magic byte, a sequence number and a CRC-8, so erased, partly
+// written or corrupted slots are simply not valid. On start the newest valid
+// record is found by scanning the slots once.
+//
+// Older records stay readable until the log erases their page again, so a layer
+// on top (e.g. the key-value store) can replay them with FLOG_slot() and
+// FLOG_valid() and copy the ones it still needs forward before that happens.
+//
+// Functions available:
+// --------------------
+// FLOG_init()              Scan the log for the newest record
+// FLOG_read(data)          Copy FLOG_DATA bytes of the newest record to data,
+//                          returns 0 if there is no valid record
+// FLOG_write(data)         Append record with FLOG_DATA bytes from data,
+//                          returns 0 if the record could not be written
+// FLOG_head()              Return slot of the newest record (FLOG_NONE if none)
+// FLOG_slot(n)             Pointer to the record in slot n
+// FLOG_valid(r)            Check if record r is written and intact
+//
+// The FLOG_PAGES pages at FLOG_ADDR must be kept out of the FLASH memory area in
+// the linker script.
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "flash.h"
+
+// Log parameters
+#ifndef FLOG_ADDR
+#define FLOG_ADDR         0x08003F00  // start of log (last 256 bytes of flash)
+#endif
+#define FLOG_PAGES        4           // number of 64-byte pages in the log
+#define FLOG_DATA         5           // data bytes per record
+#define FLOG_MAGIC        0x5A        // marks a written record
+#define FLOG_NONE         0xFF        // no valid record
+
+// Record in flash, 8 bytes
+typedef struct FLOG_record {
+  uint8_t magic;                  // FLOG_MAGIC
+  uint8_t seq;                    // sequence number, newest record has the highest
+  uint8_t data[FLOG_DATA];        // record data
+  uint8_t crc;                    // CRC-8 over the bytes before, top bit cleared
+} FLOG_record;
+
+#define FLOG_PAGE_SLOTS   (FLASH_PAGE_SIZE / sizeof(FLOG_record))
+#define FLOG_SLOTS        (FLOG_PAGES * FLOG_PAGE_SLOTS)
+#define FLOG_slot(n)      ((const FLOG_record*)(FLOG_ADDR + (n) * sizeof(FLOG_record)))
+
+// Functions
+void FLOG_init(void);
+uint8_t FLOG_read(uint8_t* data);
+uint8_t FLOG_write(const uint8_t* data);
+uint8_t FLOG_head(void);
+uint8_t FLOG_valid(const FLOG_record* r);
+
+#ifdef __cplusplus
+};
+#endif
@@ -25,20 +25,39 @@
 extern "C" {
 #endif
 
+// Shields on page 6, one byte per column from x = SHIELD_X
+#define SHIELD_X    19                      // first shield column
+#define SHIELD_W    86                      // shield columns (x = 19..104)
+#define SHIELD_GAP  35                      // distance between the shields
+#define SHIELD_BITE 2                       // pixels eroded per hit
+
+// Formation grid, the extra row below is always empty
+#define FORMATION_ROWS 4                    // grid rows with monsters
+#define FORMATION_COLS 6                    // grid columns
+#define EXPLOD_MAX  8                       // explosions at the same time
+
+// Projectile pool, positions in half pages (4 pixels)
+#define SHOTS_MAX   8                       // projectiles at the same time
+#define SHOT_FREE   0xFF                    // ShotY of an unused entry
+
 typedef struct SPACE {
   int8_t UFOxPos;
   uint8_t oneFrame;
-  uint8_t MonsterShoot[2];
-  int8_t MonsterGrid[5][6];
-  uint8_t Shield[6];                         
+  int8_t MonsterGrid[FORMATION_ROWS + 1][FORMATION_COLS];
+  uint8_t RowCount[FORMATION_ROWS];         // monsters and explosions per grid row
+  uint8_t ColCount[FORMATION_COLS];         // monsters and explosions per grid column
+  int8_t MonsterBottom;                     // lowest used grid row (-1: none)
+  int8_t MonsterLeft;                       // leftmost used grid column
+  int8_t MonsterRight;                      // rightmost used grid column (-1: none)
+  uint8_t Explod[EXPLOD_MAX];               // exploding cells, row << 4 | column
+  uint8_t ExplodCount;
+  uint8_t Shield[SHIELD_W];
   uint8_t ScrBackV;
-  int8_t MyShootBall;
-  uint8_t MyShootBallxpos;
-  uint8_t MyShootBallFrame;
+  uint8_t ShotX[SHOTS_MAX];                 // projectile column
+  uint8_t ShotY[SHOTS_MAX];                 // projectile half page 0..15 or SHOT_FREE
+  uint8_t ShotUp;                           // bit i: projectile i is a player shot
   uint8_t anim;
   uint8_t frame;
-  uint8_t PositionDansGrilleMonsterX;
-  uint8_t PositionDansGrilleMonsterY;
   uint8_t MonsterFloorMax;
   uint8_t MonsterOffsetGauche;
   uint8_t MonsterOffsetDroite;
@@ -70,6 +89,10 @@ const uint8_t SHOOT[] = {
   0b11110000, 0b00001111
 };
 
+const uint8_t SHIELD[] = {
+  0xF0, 0xFC, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFC, 0xF0
+};
+
 const uint8_t Monsters[] = {
   0x00, 0x00, 0x00, 0x58, 0xBC, 0x16, 0x3F, 0x3F, 0x16, 0xBC, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x98, 0x5C, 0xB6, 0x5F, 0x5F, 0xB6, 0x5C, 0x98, 0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x7D,
@@ -89,127 +112,85 @@ const uint8_t vesso[] = {
   0x78, 0x3C, 0xF0, 0x34, 0xF8, 0x80, 0x78, 0xEA, 0xE0, 0x74 
 };
 
+// 'back', 128x64px, indexed RLE packed with tools/bmppack.py -i
 const uint8_t back[] = {
-  0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x3F, 0x5F, 0x1F, 0xCF, 0x2F, 0xC7, 0xBF, 0xE7, 0x7F, 0xEF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x14, 0xE9, 0xF6, 0xBD, 0xEF, 0xFD, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF, 0xD7, 0x7F, 0xDF, 0xBF,
-  0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFD, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x7F, 0x1F, 0xBF, 0x0F, 0x47,
-  0x8F, 0x23, 0x47, 0x93, 0x43, 0xB5, 0x4B, 0xA3, 0xDB, 0xA5, 0xDB, 0xB3, 0xE7, 0x5B, 0xF7, 0xAF,
-  0xF7, 0x6F, 0xFF, 0xDF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x0F, 0x43, 0x15, 0x02, 0x50, 0x04, 0xA2, 0x18, 0xE2, 0x0C, 0xF2,
-  0x0C, 0xF3, 0xAC, 0xDA, 0xF5, 0xBA, 0xED, 0x7A, 0xEF, 0xDA, 0xBF, 0xF6, 0xFF, 0xEF, 0xFD, 0xF7,
-  0x7F, 0xFF, 0xED, 0xFF, 0x7F, 0xFB, 0xBF, 0xFE, 0xDF, 0x7D, 0xF7, 0xDF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x11, 0x24, 0x08, 0x52, 0x00, 0x55, 0x28, 0xC3, 0x1C, 0xD1, 0xB6, 0x4D, 0xFA, 0x57,
-  0xFD, 0xD7, 0x6E, 0xFB, 0xEE, 0x77, 0xDF, 0xF5, 0xDF, 0xFB, 0xFD, 0xBF, 0xFA, 0xFF, 0xFD, 0xFF,
-  0xFD, 0x7F, 0xFE, 0xBF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xAB, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xB6, 0xD5, 0xF7, 0x80, 0xF7, 0xD5, 0xB6, 0xFF, 0xF7, 0xFF, 0xF7,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF6, 0x48, 0xA1, 0x14, 0x49, 0xA6, 0x59, 0xA5, 0xBA, 0x6B, 0xDE, 0x75, 0xFF, 0xDB, 0x7F,
-  0xED, 0xFF, 0xF7, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB,
-  0xFF, 0xBF, 0xF7, 0xDF, 0xFB, 0xBF, 0x6D, 0xDF, 0xFF, 0xB7, 0x7F, 0xFF, 0x57, 0xBE, 0xD5, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0xE9, 0xD4, 0x6B, 0x96, 0x79, 0xD7, 0xBD, 0xD7, 0xFD, 0xEF, 0xBD, 0xF7,
-  0xDF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xEE, 0xFF, 0x77, 0xFD,
-  0xFF, 0xDF, 0xF6, 0xEF, 0x7D, 0xEB, 0xFF, 0x56, 0xBD, 0xCB, 0xF5, 0xF6, 0xFD, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFE, 0xFF, 0xFA, 0xF7, 0xFD, 0xEF, 0xF7,
+  0x28, 0x00, 0x5A, 0x00, 0x8B, 0x00, 0xCA, 0x00, 0x0E, 0x01, 0x58, 0x01, 0xA9, 0x01, 0xF1, 0x01,
+  0x0A, 0x1E, 0x28, 0x0A, 0x1E, 0x23, 0x06, 0x19, 0x32, 0x06, 0x10, 0x2F, 0x11, 0x13, 0x34, 0x16,
+  0x18, 0x38, 0x13, 0x19, 0x38, 0x0A, 0x14, 0x2F, 0x80, 0xFF, 0x00, 0xFD, 0x8F, 0xFF, 0x00, 0xFD,
+  0x89, 0xFF, 0x0C, 0xFF, 0x3F, 0x5F, 0x1F, 0xCF, 0x2F, 0xC7, 0xBF, 0xE7, 0x7F, 0xEF, 0xFF, 0xBF,
+  0x8D, 0xFF, 0x00, 0xFB, 0x81, 0xFF, 0x89, 0xFF, 0x00, 0xF7, 0x8D, 0xFF, 0x00, 0x7F, 0x82, 0xFF,
+  0x87, 0xFF, 0x00, 0x7F, 0x8E, 0xFF, 0x00, 0xF7, 0x83, 0xFF, 0x8C, 0xFF, 0x00, 0xFE, 0x88, 0xFF,
+  0x00, 0xFD, 0x84, 0xFF, 0x10, 0xC0, 0x14, 0xE9, 0xF6, 0xBD, 0xEF, 0xFD, 0xFF, 0xFD, 0xFF, 0xBF,
+  0xFF, 0xD7, 0x7F, 0xDF, 0xBF, 0xF6, 0x8D, 0xFF, 0x01, 0xFF, 0x7F, 0x9C, 0xFF, 0x82, 0xFF, 0x00,
+  0xBF, 0x8A, 0xFF, 0x00, 0xDF, 0x86, 0xFF, 0x00, 0xBF, 0x83, 0xFF, 0x8A, 0xFF, 0x00, 0xEF, 0x91,
+  0xFF, 0x80, 0xFF, 0x09, 0xFE, 0xFF, 0xFD, 0xF7, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFD, 0x80, 0xFF,
+  0x00, 0xFD, 0x8F, 0xFF, 0x88, 0xFF, 0x15, 0xBF, 0x7F, 0x1F, 0xBF, 0x0F, 0x47, 0x8F, 0x23, 0x47,
+  0x93, 0x43, 0xB5, 0x4B, 0xA3, 0xDB, 0xA5, 0xDB, 0xB3, 0xE7, 0x5B, 0xF7, 0xAF, 0x05, 0xF7, 0x6F,
+  0xFF, 0xDF, 0xFF, 0x5F, 0x88, 0xFF, 0x00, 0xBF, 0x8D, 0xFF, 0x93, 0xFF, 0x00, 0xDF, 0x88, 0xFF,
+  0x80, 0xFF, 0x00, 0xEF, 0x93, 0xFF, 0x00, 0xBF, 0x85, 0xFF, 0x82, 0xFF, 0x1B, 0x9F, 0x0F, 0x43,
+  0x15, 0x02, 0x50, 0x04, 0xA2, 0x18, 0xE2, 0x0C, 0xF2, 0x0C, 0xF3, 0xAC, 0xDA, 0xF5, 0xBA, 0xED,
+  0x7A, 0xEF, 0xDA, 0xBF, 0xF6, 0xFF, 0xEF, 0xFD, 0xF7, 0x0D, 0x7F, 0xFF, 0xED, 0xFF, 0x7F, 0xFB,
+  0xBF, 0xFE, 0xDF, 0x7D, 0xF7, 0xDF, 0xFF, 0xBF, 0x81, 0xFF, 0x00, 0xBF, 0x8C, 0xFF, 0x01, 0xFF,
+  0xFE, 0x8F, 0xFF, 0x00, 0xBF, 0x82, 0xFF, 0x00, 0xAF, 0x82, 0xFF, 0x00, 0xBF, 0x80, 0xFF, 0x9E,
+  0xFF, 0x80, 0xFF, 0x1D, 0x11, 0x24, 0x08, 0x52, 0x00, 0x55, 0x28, 0xC3, 0x1C, 0xD1, 0xB6, 0x4D,
+  0xFA, 0x57, 0xFD, 0xD7, 0x6E, 0xFB, 0xEE, 0x77, 0xDF, 0xF5, 0xDF, 0xFB, 0xFD, 0xBF, 0xFA, 0xFF,
+  0xFD, 0xFF, 0x05, 0xFD, 0x7F, 0xFE, 0xBF, 0xFF, 0xDF, 0x81, 0xFF, 0x00, 0xBF, 0x81, 0xFF, 0x01,
+  0xFE, 0xAB, 0x88, 0xFF, 0x00, 0xFD, 0x84, 0xFF, 0x8C, 0xFF, 0x00, 0xFE, 0x80, 0xFF, 0x0E, 0xF7,
+  0xFF, 0xF7, 0xFF, 0xB6, 0xD5, 0xF7, 0x80, 0xF7, 0xD5, 0xB6, 0xFF, 0xF7, 0xFF, 0xF7, 0x9E, 0xFF,
+  0x19, 0xFF, 0xF6, 0x48, 0xA1, 0x14, 0x49, 0xA6, 0x59, 0xA5, 0xBA, 0x6B, 0xDE, 0x75, 0xFF, 0xDB,
+  0x7F, 0xED, 0xFF, 0xF7, 0xFF, 0xFD, 0x7F, 0xFF, 0xFD, 0xFF, 0xFE, 0x82, 0xFF, 0x01, 0xDF, 0xFB,
+  0x0E, 0xFF, 0xBF, 0xF7, 0xDF, 0xFB, 0xBF, 0x6D, 0xDF, 0xFF, 0xB7, 0x7F, 0xFF, 0x57, 0xBE, 0xD5,
+  0x84, 0xFF, 0x00, 0x7F, 0x86, 0xFF, 0x01, 0xBF, 0xFF, 0x85, 0xFF, 0x00, 0xFD, 0x89, 0xFF, 0x00,
+  0xFE, 0x82, 0xFF, 0x01, 0xFA, 0xEF, 0x81, 0xFF, 0x00, 0xFE, 0x80, 0xFF, 0x8F, 0xFF, 0x00, 0xFD,
+  0x8C, 0xFF, 0x81, 0xFF, 0x0F, 0xFE, 0xE9, 0xD4, 0x6B, 0x96, 0x79, 0xD7, 0xBD, 0xD7, 0xFD, 0xEF,
+  0xBD, 0xF7, 0xDF, 0xFF, 0xEE, 0x82, 0xFF, 0x00, 0xEF, 0x81, 0xFF, 0x04, 0xFB, 0xEE, 0xFF, 0x77,
+  0xFD, 0x0C, 0xFF, 0xDF, 0xF6, 0xEF, 0x7D, 0xEB, 0xFF, 0x56, 0xBD, 0xCB, 0xF5, 0xF6, 0xFD, 0x91,
+  0xFF, 0x84, 0xFF, 0x00, 0xEF, 0x8D, 0xFF, 0x00, 0xFB, 0x87, 0xFF, 0x8F, 0xFF, 0x00, 0x7F, 0x88,
+  0xFF, 0x00, 0xEF, 0x81, 0xFF, 0x86, 0xFF, 0x17, 0xFD, 0xFE, 0xFF, 0xFA, 0xF7, 0xFD, 0xEF, 0xF7,
   0xDE, 0xEF, 0xFF, 0xBF, 0xEE, 0xFF, 0xDF, 0xBF, 0xFF, 0xDF, 0xFE, 0xBF, 0xFF, 0xAF, 0xFF, 0xDF,
-  0xFB, 0xFF, 0xF6, 0xFF, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+  0x06, 0xFB, 0xFF, 0xF6, 0xFF, 0xFB, 0xFF, 0xFC, 0x85, 0xFF, 0x00, 0xFE, 0x84, 0xFF, 0x00, 0xFB,
+  0x88, 0xFF
 };
 
 
+// 'Tiny Invaders Intro', 128x64px, LZ packed with tools/bmppack.py
 const uint8_t intro[] = {
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xE0,0xE0,0xE0,0xF0,0xF0,0xF0,
-  0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0xC0,0xC0,0xE0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
-  0xE0,0xE0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xF0,0xF0,0xF0,0xF0,
-  0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0xC0,0xC0,0xE0,0xF0,0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xC0,0x80,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x9C,0x1E,0x1F,
-  0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,
-  0x1F,0x1F,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x3F,0x3E,0x3C,0x38,0xB0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x06,0x04,0x04,0x04,0xFC,0x00,0x00,0x00,0x00,0x00,0xFC,0xFC,0xFC,
-  0xFC,0xFF,0xFF,0xFF,0x7F,0x1F,0xFF,0x04,0x04,0x04,0x04,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,
-  0x07,0x07,0x07,0x07,0x0F,0x07,0x07,0x07,0x07,0x07,0x07,0x0F,0x0F,0x1F,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
-  0xFF,0xFC,0x00,0x00,0x00,0x00,0x01,0xFF,0x7F,0x3F,0x1F,0x07,0x80,0x40,0x20,0x18,0x0E,0x03,0x01,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-  0x7C,0x80,0x00,0x00,0x00,0x03,0x7F,0xFF,0xFF,0xFF,0x1F,0x03,0x00,0x00,0x07,0xF8,0x00,0x00,0x00,0x00,
-  0x07,0xFF,0xFF,0x0F,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x00,0x80,0x7E,0x07,0x7F,0xFF,0xFF,0xFF,0x7E,0x00,
-  0x00,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x00,0x00,0x00,0x00,0xC0,0x30,0x18,0x06,0x03,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0xFC,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xF0,0xEE,0xFE,0xFE,0xFE,0xFE,0xFE,
-  0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xF8,0xF8,0xFE,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xE1,0xC0,0xC0,
-  0xF8,0xF8,0xF8,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xF0,0xFF,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,
-  0xF8,0xF8,0xF8,0xFF,0xFF,0xFF,0xC0,0xC0,0xC0,0xC0,0xFF,0xF8,0xFF,0xFF,0xDF,0xC7,0xC1,0xC0,0xC0,0xC0,
-  0xF8,0xF6,0xE1,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFC,0xF0,0xE0,
-  0xF0,0xF0,0xF8,0xFC,0xFC,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xF8,0xE0,0xE0,0xC0,0x00,0x00,0x00,
-  0x07,0x0F,0x79,0xE1,0xC1,0x01,0x03,0x0F,0x3F,0xFF,0xFF,0xF9,0xC3,0x83,0x07,0x0F,0x1F,0x7F,0xFF,0xFF,
-  0xF3,0x83,0x03,0x03,0x03,0x3F,0xFF,0xFF,0xFB,0xC3,0x03,0x03,0x07,0x0F,0x7F,0xFF,0xFF,0xFF,0xE1,0x01,
-  0x01,0x01,0x01,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x03,0x03,0x03,0x01,0x01,0x01,0x01,0x0F,0xFF,0xFF,
-  0xFF,0xFF,0xFF,0x03,0x03,0x03,0x03,0x03,0xF3,0xF3,0xF3,0xF3,0x03,0x03,0x07,0x0F,0x0F,0xFF,0xFF,0xFF,
-  0xFF,0x03,0x03,0x03,0x03,0x83,0xF3,0xF3,0xF3,0xF3,0xF3,0xF3,0xF3,0xFF,0xFF,0xFF,0x1F,0x03,0x01,0x01,
-  0x81,0xF1,0xF1,0xF3,0xF3,0x03,0x03,0x03,0x03,0x8F,0xFF,0xFF,0xFF,0x7F,0x1F,0x0F,0x0F,0x87,0xE3,0xF3,
-  0xF1,0x31,0x01,0x01,0x01,0x81,0xE7,0x7E,0x00,0x00,0x00,0x00,0x03,0x07,0x1C,0x38,0xE0,0x80,0x03,0x07,
-  0x1F,0x7F,0xFE,0xF0,0xE0,0x80,0x00,0x01,0x07,0x07,0xCE,0x80,0x00,0x00,0x00,0x07,0x3F,0xFF,0xFF,0xFC,
-  0xF0,0xC0,0x00,0x03,0x0F,0x3F,0xFF,0xF8,0x80,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
-  0x00,0xFE,0xFC,0xE0,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x0F,
-  0x00,0x00,0x00,0x00,0xF8,0xFF,0xFF,0x0F,0x00,0x00,0x00,0x00,0xC0,0xCF,0xCF,0xCF,0xCF,0xCF,0xFF,0xFF,
-  0xFF,0x3F,0x07,0x01,0x00,0x00,0x80,0x9E,0x9F,0x1F,0x0F,0x61,0xE0,0xF0,0xF0,0xFC,0xFF,0xFF,0xEF,0x83,
-  0x80,0x80,0x80,0x98,0x1E,0x1F,0x1E,0x1F,0xF6,0xE6,0x06,0x06,0x06,0x07,0x01,0x00,0x70,0x80,0x70,0x00,
-  0x80,0x00,0xA8,0xA8,0xF9,0x03,0x0F,0x1C,0x70,0xE0,0x81,0x83,0x8F,0xBF,0xFE,0xF8,0xE0,0x80,0x81,0x8F,
-  0x9F,0xFE,0xDC,0x30,0xE0,0xC0,0x83,0x9F,0xFF,0xCF,0x1F,0x7C,0xE0,0xC0,0x81,0x83,0x83,0x80,0x80,0x80,
-  0x80,0xFF,0xFF,0x0F,0xFF,0x80,0x80,0x80,0x80,0xF3,0x13,0x13,0xF0,0x80,0x80,0x80,0x9F,0xFF,0xFF,0xFF,
-  0x80,0x80,0x80,0xBC,0xBF,0xBF,0xBF,0x80,0x80,0xC0,0xE0,0x7F,0xFF,0xFF,0x87,0x80,0x80,0x80,0x80,0xBE,
-  0xBF,0xBF,0xBF,0xBF,0xFF,0xFF,0xFF,0x9F,0x83,0x80,0x80,0xF0,0xFE,0xFF,0xFF,0x8F,0x81,0x80,0xE0,0xF0,
-  0x3E,0xFF,0xDF,0x87,0x87,0x87,0x97,0x9F,0x9F,0xDF,0xC7,0xE1,0x60,0x38,0x1C,0x0E,0x03,0x01,0x00,0x00,
-  0x00,0x00,0x00,0x00
+  0x9D, 0x00, 0x01, 0x80, 0xC0, 0x80, 0xE0, 0x87, 0xF0, 0x02, 0xE0, 0xC0, 0xC0, 0xC7, 0x0D, 0xC9,
+  0x18, 0xCA, 0x0D, 0xC6, 0x25, 0x03, 0xE0, 0xE0, 0xC0, 0x80, 0xDB, 0x5F, 0xD9, 0x00, 0x02, 0x78,
+  0x9C, 0x1E, 0x89, 0x1F, 0x00, 0x3F, 0x84, 0xFF, 0xC2, 0x0C, 0x99, 0xFF, 0x83, 0x3F, 0xC6, 0x0C,
+  0x04, 0x3E, 0x3C, 0x38, 0xB0, 0x60, 0xD5, 0x63, 0xDA, 0x00, 0x02, 0x01, 0x02, 0x06, 0x80, 0x04,
+  0x00, 0xFC, 0xC2, 0x0B, 0x81, 0xFC, 0xC0, 0x4E, 0x02, 0x7F, 0x1F, 0xFF, 0x82, 0x04, 0xC4, 0x5D,
+  0x82, 0x07, 0x00, 0x0F, 0x83, 0x07, 0x03, 0x0F, 0x0F, 0x1F, 0x7F, 0xC3, 0x15, 0xC2, 0x31, 0x0C,
+  0x01, 0xFF, 0x7F, 0x3F, 0x1F, 0x07, 0x80, 0x40, 0x20, 0x18, 0x0E, 0x03, 0x01, 0xD6, 0x62, 0xE0,
+  0x00, 0x02, 0x03, 0x7C, 0x80, 0xC1, 0x05, 0xC1, 0x5B, 0x05, 0x1F, 0x03, 0x00, 0x00, 0x07, 0xF8,
+  0xC1, 0x14, 0x06, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x7F, 0xC1, 0x0A, 0x02, 0x80, 0x7E, 0x07,
+  0xC1, 0x1B, 0x00, 0x7E, 0xC1, 0x0A, 0x84, 0xFF, 0xC1, 0x0B, 0x04, 0x00, 0xC0, 0x30, 0x18, 0x06,
+  0xC0, 0x2F, 0xDB, 0x00, 0x05, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x84, 0xFE, 0xC4, 0x07, 0x02,
+  0xFC, 0xF0, 0xEE, 0x87, 0xFE, 0x04, 0xFC, 0xF8, 0xF8, 0xFE, 0xFF, 0x82, 0xC0, 0x04, 0xFF, 0xFF,
+  0xE1, 0xC0, 0xC0, 0x80, 0xF8, 0xC5, 0x0D, 0x01, 0xF0, 0xFF, 0xC4, 0x09, 0xC1, 0x13, 0xC3, 0x0B,
+  0x00, 0xFF, 0xC0, 0x08, 0x02, 0xDF, 0xC7, 0xC1, 0xC0, 0x09, 0x02, 0xF8, 0xF6, 0xE1, 0x85, 0xF8,
+  0xC5, 0x54, 0x01, 0xE0, 0xF0, 0xC0, 0x69, 0xC5, 0x6A, 0x04, 0xFE, 0xF8, 0xE0, 0xE0, 0xC0, 0xC0,
+  0x7E, 0x15, 0x07, 0x0F, 0x79, 0xE1, 0xC1, 0x01, 0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xF9, 0xC3, 0x83,
+  0x07, 0x0F, 0x1F, 0x7F, 0xFF, 0xFF, 0xF3, 0x83, 0x80, 0x03, 0xC0, 0x10, 0x05, 0xFB, 0xC3, 0x03,
+  0x03, 0x07, 0x0F, 0xC0, 0x10, 0x01, 0xFF, 0xE1, 0x81, 0x01, 0x00, 0x03, 0x82, 0xFF, 0x81, 0x03,
+  0xC1, 0x0D, 0x00, 0x0F, 0xC6, 0x0D, 0x00, 0x03, 0x81, 0xF3, 0xC1, 0x29, 0xC2, 0x12, 0xC1, 0x10,
+  0x00, 0x83, 0x84, 0xF3, 0xC0, 0x0E, 0x00, 0x1F, 0xC0, 0x2C, 0x02, 0x81, 0xF1, 0xF1, 0xC1, 0x20,
+  0x02, 0x03, 0x03, 0x8F, 0xC0, 0x10, 0x08, 0x7F, 0x1F, 0x0F, 0x0F, 0x87, 0xE3, 0xF3, 0xF1, 0x31,
+  0xC0, 0x43, 0x02, 0x81, 0xE7, 0x7E, 0x81, 0x00, 0x13, 0x03, 0x07, 0x1C, 0x38, 0xE0, 0x80, 0x03,
+  0x07, 0x1F, 0x7F, 0xFE, 0xF0, 0xE0, 0x80, 0x00, 0x01, 0x07, 0x07, 0xCE, 0x80, 0xC0, 0x16, 0x0C,
+  0x07, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xF8, 0xC1, 0x10, 0xC0,
+  0x0F, 0x01, 0xFF, 0xFF, 0xC1, 0x30, 0x02, 0xFE, 0xFC, 0xE0, 0xC0, 0x35, 0x82, 0xFF, 0xC1, 0x0E,
+  0xC0, 0x06, 0x00, 0x0F, 0xC1, 0x07, 0x00, 0xF8, 0xC4, 0x07, 0x00, 0xC0, 0x82, 0xCF, 0xC0, 0x15,
+  0x12, 0x3F, 0x07, 0x01, 0x00, 0x00, 0x80, 0x9E, 0x9F, 0x1F, 0x0F, 0x61, 0xE0, 0xF0, 0xF0, 0xFC,
+  0xFF, 0xFF, 0xEF, 0x83, 0x80, 0x80, 0x06, 0x98, 0x1E, 0x1F, 0x1E, 0x1F, 0xF6, 0xE6, 0x80, 0x06,
+  0xC0, 0x1E, 0x27, 0x70, 0x80, 0x70, 0x00, 0x80, 0x00, 0xA8, 0xA8, 0xF9, 0x03, 0x0F, 0x1C, 0x70,
+  0xE0, 0x81, 0x83, 0x8F, 0xBF, 0xFE, 0xF8, 0xE0, 0x80, 0x81, 0x8F, 0x9F, 0xFE, 0xDC, 0x30, 0xE0,
+  0xC0, 0x83, 0x9F, 0xFF, 0xCF, 0x1F, 0x7C, 0xE0, 0xC0, 0x81, 0x83, 0xC1, 0x38, 0x00, 0x80, 0xC0,
+  0x5F, 0x00, 0xFF, 0xC1, 0x07, 0x03, 0xF3, 0x13, 0x13, 0xF0, 0xC0, 0x06, 0x00, 0x9F, 0xC0, 0x62,
+  0xC0, 0x06, 0x00, 0xBC, 0x80, 0xBF, 0x07, 0x80, 0x80, 0xC0, 0xE0, 0x7F, 0xFF, 0xFF, 0x87, 0xC1,
+  0x1D, 0x00, 0xBE, 0x81, 0xBF, 0xC0, 0x1A, 0x00, 0x9F, 0xC0, 0x33, 0x0B, 0xF0, 0xFE, 0xFF, 0xFF,
+  0x8F, 0x81, 0x80, 0xE0, 0xF0, 0x3E, 0xFF, 0xDF, 0x80, 0x87, 0x0B, 0x97, 0x9F, 0x9F, 0xDF, 0xC7,
+  0xE1, 0x60, 0x38, 0x1C, 0x0E, 0x03, 0x01, 0x83, 0x00
 };
 
 #ifdef __cplusplus
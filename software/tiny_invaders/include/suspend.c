@@ -0,0 +1,95 @@
+// ===================================================================================
+// Suspend to Flash for CH32V003                                              * v1.0 *
+// ===================================================================================
+
+#include "suspend.h"
+
+#define SUSPEND_DATA      (SUSPEND_ADDR + FLASH_PAGE_SIZE)            // first data page
+#define SUSPEND_MAX       ((SUSPEND_PAGES - 1) * FLASH_PAGE_SIZE)     // max image length
+#define SUSPEND_header    ((const SUSPEND_head*)SUSPEND_ADDR)
+
+static uint32_t SUSPEND_buf[FLASH_PAGE_SIZE / 4]; // page buffer for saving
+static uint8_t  SUSPEND_mode;                 // SUSPEND_SAVE or SUSPEND_LOAD
+static uint8_t  SUSPEND_id;                   // game ID
+static uint8_t  SUSPEND_ok;                   // no error so far
+static uint16_t SUSPEND_pos;                  // number of bytes transferred
+static uint16_t SUSPEND_crc;                  // CRC-16 of bytes saved so far
+
+// Update CRC-16 (CCITT) with one byte
+static uint16_t SUSPEND_crc_add(uint16_t crc, uint8_t b) {
+  crc ^= (uint16_t)b << 8;
+  for(uint8_t i = 8; i; i--) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  return crc;
+}
+
+// Calculate CRC-16 of the first n data bytes in flash
+static uint16_t SUSPEND_crc_flash(uint16_t n) {
+  const uint8_t* p = (const uint8_t*)SUSPEND_DATA;
+  uint16_t crc = 0xFFFF;
+  while(n--) crc = SUSPEND_crc_add(crc, *p++);
+  return crc;
+}
+
+// Write the page buffer to the data page at offset
+static void SUSPEND_flush(uint16_t offset) {
+  uint32_t addr = SUSPEND_DATA + offset;
+  FLASH_erase(addr);
+  FLASH_page(addr, SUSPEND_buf);
+}
+
+// Start saving or loading the image of game id
+uint8_t SUSPEND_begin(uint8_t mode, uint8_t id) {
+  SUSPEND_mode = mode;
+  SUSPEND_id   = id;
+  SUSPEND_ok   = 1;
+  SUSPEND_pos  = 0;
+  SUSPEND_crc  = 0xFFFF;
+  if(mode == SUSPEND_LOAD) {
+    const SUSPEND_head* h = SUSPEND_header;
+    return (h->magic == SUSPEND_MAGIC) && (h->id == id) && (h->len <= SUSPEND_MAX)
+        && (h->crc == SUSPEND_crc_flash(h->len));
+  }
+  FLASH_unlock();
+  FLASH_erase(SUSPEND_ADDR);                  // drop the old image first
+  return 1;
+}
+
+// Save or load n bytes at p
+void SUSPEND_xfer(void* p, uint16_t n) {
+  uint8_t* b = (uint8_t*)p;
+  for(; n; n--, b++) {
+    if(SUSPEND_mode == SUSPEND_LOAD) {
+      if(SUSPEND_pos >= SUSPEND_header->len) {SUSPEND_ok = 0; return;}
+      *b = ((const uint8_t*)SUSPEND_DATA)[SUSPEND_pos++];
+      continue;
+    }
+    if(SUSPEND_pos >= SUSPEND_MAX) {SUSPEND_ok = 0; return;}
+    ((uint8_t*)SUSPEND_buf)[SUSPEND_pos % FLASH_PAGE_SIZE] = *b;
+    SUSPEND_crc = SUSPEND_crc_add(SUSPEND_crc, *b);
+    if(++SUSPEND_pos % FLASH_PAGE_SIZE == 0) SUSPEND_flush(SUSPEND_pos - FLASH_PAGE_SIZE);
+  }
+}
+
+// Finish saving or loading
+uint8_t SUSPEND_end(void) {
+  if(SUSPEND_mode == SUSPEND_LOAD) {
+    if(SUSPEND_pos != SUSPEND_header->len) SUSPEND_ok = 0;
+    FLASH_unlock();
+    FLASH_erase(SUSPEND_ADDR);                // resume an image only once
+    FLASH_lock();
+    return SUSPEND_ok;
+  }
+  if(SUSPEND_ok) {
+    if(SUSPEND_pos % FLASH_PAGE_SIZE) SUSPEND_flush(SUSPEND_pos & ~(FLASH_PAGE_SIZE - 1));
+    for(uint8_t i = 0; i < FLASH_PAGE_SIZE / 4; i++) SUSPEND_buf[i] = 0;
+    SUSPEND_head* h = (SUSPEND_head*)SUSPEND_buf;
+    h->magic = SUSPEND_MAGIC;
+    h->id    = SUSPEND_id;
+    h->len   = SUSPEND_pos;
+    h->crc   = SUSPEND_crc;
+    FLASH_page(SUSPEND_ADDR, SUSPEND_buf);    // header last, validates the image
+  }
+  FLASH_lock();
+  return SUSPEND_ok && (SUSPEND_header->magic == SUSPEND_MAGIC)
+      && (SUSPEND_header->crc == SUSPEND_crc_flash(SUSPEND_pos));
+}
@@ -40,8 +40,22 @@ uint8_t LEVELS = 0;
 uint8_t SpeedShootMonster = 0;
 uint8_t ShipDead = 0;
 uint8_t ShipPos = 56;
+PACK_cursor BackCursor;
+uint8_t MonsterLine[FORMATION_COLS * 14]; // formation on the current page, 14 bytes per column
+uint8_t MonsterOnPage = 0;    // formation overlaps the current page
+uint8_t ShotPage[8];          // bit i: projectile i is on this page
+uint32_t ShotCols[4];         // columns with a projectile on the current page
 
-#define SHOOTS 2
+#define SHOOTS 6              // frames between two player shots
+#define PLAYER_SHOTS 3        // player shots at the same time
+
+#define RENDER_SHADOW 1       // 0: send every frame in full, 1: send changed bytes only
+#define SHADOW_GAP 8          // unchanged bytes sent along rather than starting a new run
+
+#if RENDER_SHADOW == 1
+uint8_t Shadow[8 * 128];      // copy of the OLED content, one line of 128 bytes per page
+uint8_t ShadowValid = 0;      // shadow buffer matches the OLED
+#endif
 
 // ===================================================================================
 // Function Prototypes
@@ -50,32 +64,36 @@ void LoadMonstersLevels(int8_t Levels, SPACE *space);
 void SnD(int8_t Sp_, uint8_t SN);
 void SpeedControle(SPACE *space);
 void GRIDMonsterFloorY(SPACE *space);
+void FormationCount(SPACE *space);
+void FormationBounds(SPACE *space);
+void MonsterKill(uint8_t y, uint8_t x, SPACE *space);
 uint8_t LivePrint(uint8_t x, uint8_t y);
+uint8_t ScreenByte(uint8_t x, uint8_t y, SPACE *space);
+void ShadowSend(uint8_t y, uint8_t x0, uint8_t x1);
 void Tiny_Flip(uint8_t render0_picture1, SPACE *space);
 uint8_t UFOWrite(uint8_t x, uint8_t y, SPACE *space);
 void UFOUpdate(SPACE *space);
-void ShipDestroyByMonster(SPACE *space);
-void MonsterShootupdate(SPACE *space);
+uint8_t ShotCount(uint8_t up, SPACE *space);
+uint8_t ShotFire(uint8_t x, uint8_t y, uint8_t up, SPACE *space);
+void ShotsUpdate(SPACE *space);
+void ShotsPages(SPACE *space);
+void ShotsRow(uint8_t y, SPACE *space);
+uint8_t Shots(uint8_t x, uint8_t y, SPACE *space);
+uint8_t ShotHitMonster(uint8_t i, SPACE *space);
 void MonsterShootGenerate(SPACE *space);
-uint8_t MonsterShoot(uint8_t x, uint8_t y, SPACE *space);
 uint8_t ShieldDestroy(uint8_t Origine, uint8_t VarX, uint8_t VarY, SPACE *space);
-void ShieldDestroyWrite(uint8_t BOOLWRITE, uint8_t line, SPACE *space, uint8_t Origine);
 uint8_t MyShield(uint8_t x, uint8_t y, SPACE *space);
-uint8_t ShieldBlitz(uint8_t Part, uint8_t LineSH);
-uint8_t BOOLREAD(uint8_t SHnum, uint8_t LineSH, SPACE *space);
+void ShieldReset(SPACE *space);
 void RemoveExplodOnMonsterGrid(SPACE *space);
 uint8_t background(uint8_t x, uint8_t y, SPACE *space);
 uint8_t Vesso(uint8_t x, uint8_t y, SPACE *space);
-void UFO_Attack_Check(uint8_t x, SPACE *space);
-uint8_t MyShoot(uint8_t x, uint8_t y, SPACE *space);
-void Monster_Attack_Check(SPACE *space);
-int8_t OuDansLaGrilleMonster(uint8_t x, uint8_t y, SPACE *space);
-uint8_t SplitSpriteDecalageY(uint8_t Input, uint8_t UPorDOWN, SPACE *space);
-uint8_t Murge_Split_UP_DOWN(uint8_t x, SPACE *space);
-uint8_t WriteMonster14(uint8_t x);
+uint8_t UFO_Attack_Check(uint8_t x, SPACE *space);
+const uint8_t* MonsterSprite(int8_t SpriteType, SPACE *space);
+void MonsterPage(uint8_t y, SPACE *space);
 uint8_t Monster(uint8_t x, uint8_t y, SPACE *space);
 uint8_t MonsterRefreshMove(SPACE *space);
 void VarResetNewLevel(SPACE *space);
+uint8_t SuspendGame(uint8_t mode, SPACE *space, uint8_t *Decompte, uint8_t *VarPot, uint8_t *MyShootReady);
 
 // ===================================================================================
 // Main Function
@@ -83,6 +101,7 @@ void VarResetNewLevel(SPACE *space);
 int main(void) {
   // Setup
   JOY_init();
+  PACK_open(&BackCursor, back);
 
   // Loop
   while(1) {
@@ -91,6 +110,8 @@ int main(void) {
     uint8_t MyShootReady = SHOOTS;
     SPACE space;
 
+    if(SuspendGame(SUSPEND_LOAD, &space, &Decompte, &VarPot, &MyShootReady)) goto RESUME;
+
   NEWGAME:
     Live = 3;
     LEVELS = 0;
@@ -122,6 +143,7 @@ int main(void) {
     Decompte = 0;
     Tiny_Flip(0, &space);
     JOY_DLY_ms(1000);
+  RESUME:
     while(1) {
       if(MONSTERrest == 0) { 
         JOY_sound(110, 255); JOY_DLY_ms(40); JOY_sound(130, 255); JOY_DLY_ms(40);
@@ -137,7 +159,7 @@ int main(void) {
       Tiny_Flip(0, &space);
       space.oneFrame = !space.oneFrame;
       RemoveExplodOnMonsterGrid(&space);
-      MonsterShootupdate(&space);
+      ShotsUpdate(&space);
       UFOUpdate(&space);
       if(((space.MonsterGroupeXpos >= 26) && (space.MonsterGroupeXpos <= 28))
         && (space.MonsterGroupeYpos == 2) && (space.DecalageY8 == 4)) space.UFOxPos = 127;
@@ -160,8 +182,8 @@ int main(void) {
         if(JOY_right_pressed()) {
           if(VarPot < 108) VarPot = VarPot + 6;
         }
-        if((JOY_act_pressed()) && (MyShootReady == SHOOTS)) {
-          JOY_sound(200, 4); MyShootReady = 0; space.MyShootBall = 6; space.MyShootBallxpos = ShipPos + 6;
+        if((JOY_act_pressed()) && (MyShootReady == SHOOTS) && (ShotCount(1, &space) < PLAYER_SHOTS)) {
+          if(ShotFire(ShipPos + 6, 13, 1, &space)) {JOY_sound(200, 4); MyShootReady = 0;}
         }
       }
       else {
@@ -173,8 +195,10 @@ int main(void) {
           else goto RestartLevel;
         }
       }
-      if(space.MyShootBall == -1) {
-        if(MyShootReady<SHOOTS) MyShootReady++;
+      if(MyShootReady < SHOOTS) MyShootReady++;
+      if(JOY_suspend_due()) {
+        SuspendGame(SUSPEND_SAVE, &space, &Decompte, &VarPot, &MyShootReady);
+        JOY_sleep();
       }
     JOY_SLOWDOWN();
     }
@@ -184,6 +208,23 @@ int main(void) {
 // ===================================================================================
 // Functions
 // ===================================================================================
+// Save or load the running game, see suspend.h
+uint8_t SuspendGame(uint8_t mode, SPACE *space, uint8_t *Decompte, uint8_t *VarPot, uint8_t *MyShootReady) {
+  if(!SUSPEND_begin(mode, 'I')) return 0;
+  SUSPEND_var(*space);
+  SUSPEND_var(*Decompte);
+  SUSPEND_var(*VarPot);
+  SUSPEND_var(*MyShootReady);
+  SUSPEND_var(Live);
+  SUSPEND_var(ShieldRemoved);
+  SUSPEND_var(MONSTERrest);
+  SUSPEND_var(LEVELS);
+  SUSPEND_var(SpeedShootMonster);
+  SUSPEND_var(ShipDead);
+  SUSPEND_var(ShipPos);
+  return SUSPEND_end();
+}
+
 void LoadMonstersLevels(int8_t Levels, SPACE *space) {
   uint8_t x, y;
   for(y=0; y<5; y++) {
@@ -192,6 +233,7 @@ void LoadMonstersLevels(int8_t Levels, SPACE *space) {
       else     space->MonsterGrid[y][x] = -1;
     }
   }
+  FormationCount(space);
 }
 
 void SnD(int8_t Sp_, uint8_t SN) {
@@ -200,25 +242,54 @@ void SnD(int8_t Sp_, uint8_t SN) {
 }
 
 void SpeedControle(SPACE *space) {
-  uint8_t xx, yy;
-  MONSTERrest = 0;
-  for(yy=0; yy<4; yy++) {
-    for(xx=0; xx<6; xx++) {
-      if((space->MonsterGrid[yy][xx] != -1) && ((space->MonsterGrid[yy][xx] <=5 ))) MONSTERrest++;
-    }
-  }
   space->frameMax = (MONSTERrest >> 3);
 }
 
 // Thanks to Sven Bruns for informing me of an error in this function!
 void GRIDMonsterFloorY(SPACE *space) {
-  uint8_t y,x;
-  space->MonsterFloorMax = 3;
-  for(y=0; y<4; y++) {
-    for(x=0; x<6; x++) {
-      if(space->MonsterGrid[3-y][x] != -1) return;
+  space->MonsterFloorMax = space->MonsterBottom;
+}
+
+// Count monsters of a new formation, after that the counters are only updated when
+// a cell changes (MonsterKill(), RemoveExplodOnMonsterGrid())
+void FormationCount(SPACE *space) {
+  uint8_t x, y;
+  MONSTERrest = 0;
+  space->ExplodCount = 0;
+  for(x=0; x<FORMATION_COLS; x++) space->ColCount[x] = 0;
+  for(y=0; y<FORMATION_ROWS; y++) {
+    space->RowCount[y] = 0;
+    for(x=0; x<FORMATION_COLS; x++) {
+      if(space->MonsterGrid[y][x] == -1) continue;
+      space->RowCount[y]++;
+      space->ColCount[x]++;
+      if(space->MonsterGrid[y][x] <= 5) MONSTERrest++;
     }
-    space->MonsterFloorMax = space->MonsterFloorMax - 1;
+  }
+  FormationBounds(space);
+}
+
+// Bounding box of the used grid cells from the row and column counters
+void FormationBounds(SPACE *space) {
+  int8_t i;
+  for(i=FORMATION_ROWS-1; (i >= 0) && (space->RowCount[i] == 0); i--);
+  space->MonsterBottom = i;
+  for(i=FORMATION_COLS-1; (i >= 0) && (space->ColCount[i] == 0); i--);
+  space->MonsterRight = i;
+  for(i=0; (i < FORMATION_COLS - 1) && (space->ColCount[i] == 0); i++);
+  space->MonsterLeft = i;
+}
+
+// Monster at grid row y, column x was hit and starts to explode
+void MonsterKill(uint8_t y, uint8_t x, SPACE *space) {
+  space->MonsterGrid[y][x] = 8;
+  MONSTERrest--;
+  if(space->ExplodCount < EXPLOD_MAX) space->Explod[space->ExplodCount++] = (y << 4) | x;
+  else {
+    space->MonsterGrid[y][x] = -1;
+    space->RowCount[y]--;
+    space->ColCount[x]--;
+    FormationBounds(space);
   }
 }
 
@@ -230,42 +301,71 @@ uint8_t LivePrint(uint8_t x, uint8_t y) {
   return 0x00;
 }
 
-void Tiny_Flip(uint8_t render0_picture1, SPACE *space) {
-  uint8_t y, x; 
+uint8_t ScreenByte(uint8_t x, uint8_t y, SPACE *space) {
   uint8_t MYSHIELD = 0x00;
+  if(ShieldRemoved == 0) MYSHIELD = MyShield(x, y, space);
+  return( background(x, y, space)
+          | LivePrint(x, y)
+          | Vesso(x, y, space)
+          | UFOWrite(x, y, space)
+          | Monster(x, y, space)
+          | Shots(x, y, space)
+          | MYSHIELD);
+}
+
+#if RENDER_SHADOW == 1
+void ShadowSend(uint8_t y, uint8_t x0, uint8_t x1) {
+  uint8_t *line = &Shadow[y << 7];
+  JOY_OLED_data_start_at(x0, y);
+  for(; x0<=x1; x0++) JOY_OLED_send(line[x0]);
+  JOY_OLED_end();
+}
+#endif
+
+void Tiny_Flip(uint8_t render0_picture1, SPACE *space) {
+  uint8_t y, x;
+  if(render0_picture1 != 0) {
+    JOY_OLED_draw_packed(intro);
+    #if RENDER_SHADOW == 1
+    ShadowValid = 0;
+    #endif
+    return;
+  }
+  ShotsPages(space);
   for(y=0; y<8; y++) {
-    JOY_OLED_data_start(y);
+    MonsterPage(y, space);
+    ShotsRow(y, space);
+    #if RENDER_SHADOW == 1
+    uint8_t *line = &Shadow[y << 7];
+    int16_t first = -1;                           // start of the pending run, -1: none
+    uint8_t last = 0;                             // last changed byte of the run
     for(x=0; x<128; x++) {
-      if(render0_picture1 == 0) {
-        if(ShieldRemoved == 0) MYSHIELD = MyShield(x, y, space);
-        else MYSHIELD = 0x00;
-        JOY_OLED_send( background(x, y, space)
-                       | LivePrint(x, y) 
-                       | Vesso(x, y, space)
-                       | UFOWrite(x, y, space)
-                       | Monster(x, y, space)
-                       | MyShoot(x, y, space)
-                       | MonsterShoot(x, y, space)
-                       | MYSHIELD);
+      uint8_t b = ScreenByte(x, y, space);
+      if(ShadowValid && (line[x] == b)) {
+        if((first >= 0) && (x - last > SHADOW_GAP)) {
+          ShadowSend(y, first, last);
+          first = -1;
+        }
+        continue;
       }
-      else JOY_OLED_send(intro[x + (y * 128)]);
-    }
-    if(render0_picture1 == 0) {
-      if(ShieldRemoved == 0) ShieldDestroy(0, space->MyShootBallxpos, space->MyShootBall, space);
+      line[x] = b;
+      if(first < 0) first = x;
+      last = x;
     }
+    if(first >= 0) ShadowSend(y, first, last);
+    #else
+    JOY_OLED_data_start(y);
+    for(x=0; x<128; x++) JOY_OLED_send(ScreenByte(x, y, space));
     JOY_OLED_end();
+    #endif
   }
-  if(render0_picture1 == 0) {
-    if(!(space->MonsterGroupeYpos < (2 + (4 - (space->MonsterFloorMax + 1))))) {
-      if(ShieldRemoved != 1) {
-        space->Shield[0] = 0x00;
-        space->Shield[1] = 0x00;
-        space->Shield[2] = 0x00;
-        space->Shield[3] = 0x00;
-        space->Shield[4] = 0x00;
-        space->Shield[5] = 0x00;
-        ShieldRemoved = 1;
-      }
+  #if RENDER_SHADOW == 1
+  ShadowValid = 1;
+  #endif
+  if(!(space->MonsterGroupeYpos < (2 + (4 - (space->MonsterFloorMax + 1))))) {
+    if(ShieldRemoved != 1) {
+      for(x=0; x<SHIELD_W; x++) space->Shield[x] = 0x00;
+      ShieldRemoved = 1;
     }
   }
 }
@@ -284,189 +384,160 @@ void UFOUpdate(SPACE *space) {
   }
 }
 
-void ShipDestroyByMonster(SPACE *space) {
-  if((space->MonsterShoot[1] >= 14) && (space->MonsterShoot[1] <= 15) 
-  && (space->MonsterShoot[0] >= ShipPos) && (space->MonsterShoot[0] <= ShipPos+14))
-    ShipDead=1;
+// Number of player (up = 1) or monster (up = 0) shots in the projectile pool
+uint8_t ShotCount(uint8_t up, SPACE *space) {
+  uint8_t i, n = 0;
+  for(i=0; i<SHOTS_MAX; i++) {
+    if((space->ShotY[i] != SHOT_FREE) && (((space->ShotUp >> i) & 1) == up)) n++;
+  }
+  return n;
 }
 
-void MonsterShootupdate(SPACE *space) {
-  if(space->MonsterShoot[1] != 16) {
-    ShipDestroyByMonster(space);
-    if(ShieldDestroy(1, space->MonsterShoot[0], space->MonsterShoot[1] >> 1, space))
-      space->MonsterShoot[1] = 16;
-    else
-      space->MonsterShoot[1] = space->MonsterShoot[1] + 1;
+// Put a projectile at column x, half page y into the pool, returns 0 if full
+uint8_t ShotFire(uint8_t x, uint8_t y, uint8_t up, SPACE *space) {
+  uint8_t i;
+  for(i=0; i<SHOTS_MAX; i++) {
+    if(space->ShotY[i] != SHOT_FREE) continue;
+    space->ShotX[i] = x;
+    space->ShotY[i] = y;
+    if(up) space->ShotUp |=  (1 << i);
+    else   space->ShotUp &= ~(1 << i);
+    return 1;
   }
+  return 0;
 }
 
-void MonsterShootGenerate(SPACE *space) {
-  uint8_t a = JOY_random() % 3; 
-  uint8_t b = JOY_random() % 6; 
-  if(b >= 5) b = 5;
-  if(space->MonsterShoot[1] == 16) {
-    if(space->MonsterGrid[a][b] != -1) {
-      space->MonsterShoot[0] = (space->MonsterGroupeXpos + 7) + (b * 14);
-      space->MonsterShoot[1] = ((space->MonsterGroupeYpos + a) * 2) + 1;
+// Move all projectiles by half a page and check what they hit: player shots go up
+// against the formation grid, the UFO and the shields, monster shots go down
+// against the ship and the shields
+void ShotsUpdate(SPACE *space) {
+  uint8_t i;
+  for(i=0; i<SHOTS_MAX; i++) {
+    uint8_t y = space->ShotY[i];
+    if(y == SHOT_FREE) continue;
+    if((space->ShotUp >> i) & 1) {
+      if(y == 0) {space->ShotY[i] = SHOT_FREE; continue;}
+      space->ShotY[i] = --y;
+      if( ShotHitMonster(i, space)
+      || ((y >> 1 == 0) && UFO_Attack_Check(space->ShotX[i], space))
+      || ShieldDestroy(0, space->ShotX[i], y >> 1, space) ) space->ShotY[i] = SHOT_FREE;
+    }
+    else {
+      if((y >= 14) && (space->ShotX[i] >= ShipPos) && (space->ShotX[i] <= ShipPos + 14)) ShipDead = 1;
+      if(ShieldDestroy(1, space->ShotX[i], y >> 1, space) || (++y == 16)) space->ShotY[i] = SHOT_FREE;
+      else space->ShotY[i] = y;
     }
   }
 }
 
-uint8_t MonsterShoot(uint8_t x, uint8_t y, SPACE *space) {
-  if(((space->MonsterShoot[1] >> 1) == y) && (space->MonsterShoot[0] == x)) {
-    if((space->MonsterShoot[1] & 1) == 0) return 0b00001111;
-    else return 0b11110000;
+// Sort the projectiles into page buckets, once per frame before rendering
+void ShotsPages(SPACE *space) {
+  uint8_t i;
+  for(i=0; i<8; i++) ShotPage[i] = 0;
+  for(i=0; i<SHOTS_MAX; i++) {
+    if(space->ShotY[i] != SHOT_FREE) ShotPage[space->ShotY[i] >> 1] |= (1 << i);
   }
-  return 0x00;
 }
 
-uint8_t ShieldDestroy(uint8_t Origine, uint8_t VarX, uint8_t VarY, SPACE *space) {
-  #define OFFSETXSHIELD -1
-  if(VarY == 6) {
-    if((VarX >= 20 + OFFSETXSHIELD) && (VarX <= 27 + OFFSETXSHIELD)) {
-      if(BOOLREAD(0, VarX - (20 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(0, VarX - (20 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
-    if((VarX >= 28 + OFFSETXSHIELD) && (VarX <= 35 + OFFSETXSHIELD)) {
-      if(BOOLREAD(1, VarX - (28 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(1, VarX - (28 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
-    if((VarX >= 55 + OFFSETXSHIELD) && (VarX <= 62 + OFFSETXSHIELD)) {
-      if(BOOLREAD(2, VarX - (55 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(2, VarX - (55 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
-    if((VarX >= 63 + OFFSETXSHIELD) && (VarX <= 70 + OFFSETXSHIELD)) {
-      if(BOOLREAD(3, VarX - (63 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(3, VarX - (63 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
-    if((VarX >= 90 + OFFSETXSHIELD) && (VarX <= 97 + OFFSETXSHIELD)) {
-      if(BOOLREAD(4, VarX - (90 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(4, VarX - (90 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
-    if((VarX >= 98 + OFFSETXSHIELD) && (VarX <= 105 + OFFSETXSHIELD)) {
-      if(BOOLREAD(5, VarX - (98 + OFFSETXSHIELD), space)) {
-        ShieldDestroyWrite(5, VarX - (98 + OFFSETXSHIELD), space, Origine);
-        return 1;
-      }
-    }
+// Mark the columns of the projectiles on page y
+void ShotsRow(uint8_t y, SPACE *space) {
+  uint8_t i, m = ShotPage[y];
+  ShotCols[0] = ShotCols[1] = ShotCols[2] = ShotCols[3] = 0;
+  for(i=0; m; i++, m>>=1) {
+    if(m & 1) ShotCols[space->ShotX[i] >> 5] |= (uint32_t)1 << (space->ShotX[i] & 31);
   }
-  return 0;
 }
 
-void ShieldDestroyWrite(uint8_t BOOLWRITE, uint8_t line, SPACE *space, uint8_t Origine) {
-  switch(line) {
-    case 0:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 128;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 1:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 64;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 2:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 32;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 3:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 16;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 4:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 8;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 5:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 4;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 6:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 2;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    case 7:
-      space->Shield[BOOLWRITE] = space->Shield[BOOLWRITE] - 1;
-      if(Origine == 0) space->MyShootBall = -1;
-      break;
-    default:
-      break;
+uint8_t Shots(uint8_t x, uint8_t y, SPACE *space) {
+  uint8_t i, m, b = 0x00;
+  if(!((ShotCols[x >> 5] >> (x & 31)) & 1)) return 0x00;
+  for(i=0, m=ShotPage[y]; m; i++, m>>=1) {
+    if((m & 1) && (space->ShotX[i] == x)) b |= SHOOT[!(space->ShotY[i] & 1)];
   }
+  return b;
 }
 
-uint8_t MyShield(uint8_t x, uint8_t y, SPACE *space) {
-  #define OFFSETXSHIELD -1
-  if(y != 6) return 0x00;
-  if((x >= 20 + OFFSETXSHIELD) && (x <= 27 + OFFSETXSHIELD)) {
-    if(BOOLREAD(0, x - (20 + OFFSETXSHIELD), space)) return ShieldBlitz(0, x - (20 + OFFSETXSHIELD));
-    else return 0x00;
-  }
-  if((x >= 28 + OFFSETXSHIELD) && (x <= 35 + OFFSETXSHIELD)) {
-    if(BOOLREAD(1, x - (28 + OFFSETXSHIELD), space)) return ShieldBlitz(1, x - (28 + OFFSETXSHIELD));
-    else return 0x00;
-  }
-  if((x >= 55 + OFFSETXSHIELD) && (x <= 62 + OFFSETXSHIELD)) {
-    if(BOOLREAD(2, x - (55 + OFFSETXSHIELD), space)) return ShieldBlitz(0, x - (55 + OFFSETXSHIELD));
-    else return 0x00;
-  }
-  if((x >= 63 + OFFSETXSHIELD) && (x <= 70 + OFFSETXSHIELD)) {
-    if(BOOLREAD(3, x - (63 + OFFSETXSHIELD), space)) return ShieldBlitz(1, x - (63 + OFFSETXSHIELD));
-    else return 0x00;
-  }
-  if((x >= 90 + OFFSETXSHIELD) && (x <= 97 + OFFSETXSHIELD)) {
-    if(BOOLREAD(4, x - (90 + OFFSETXSHIELD), space)) return ShieldBlitz(0, x - (90 + OFFSETXSHIELD));
-    else return 0x00;
-  }
-  if((x >= 98 + OFFSETXSHIELD) && (x <= 105 + OFFSETXSHIELD)) {
-    if(BOOLREAD(5, x - (98 + OFFSETXSHIELD), space)) return ShieldBlitz(1, x - (98 + OFFSETXSHIELD));
-    else return 0x00;
+// Player shot i against the formation grid, the shot hits with its middle pixel
+uint8_t ShotHitMonster(uint8_t i, SPACE *space) {
+  uint8_t top = (space->MonsterGroupeYpos << 3) + space->DecalageY8;
+  uint8_t yy  = (space->ShotY[i] << 2) + 2;
+  uint8_t xx  = space->ShotX[i] - space->MonsterGroupeXpos;
+  uint8_t row, col;
+  if((yy < top) || (space->ShotX[i] < space->MonsterGroupeXpos)) return 0;
+  row = (yy - top) >> 3;
+  col = xx / 14;
+  if((row >= FORMATION_ROWS) || (col >= FORMATION_COLS)) return 0;
+  if((space->MonsterGrid[row][col] < 0) || (space->MonsterGrid[row][col] > 5)) return 0;
+  JOY_sound(50, 10);
+  MonsterKill(row, col, space);
+  SpeedControle(space);
+  return 1;
+}
+
+void MonsterShootGenerate(SPACE *space) {
+  uint8_t a = JOY_random() % 3; 
+  uint8_t b = JOY_random() % 6; 
+  if(b >= 5) b = 5;
+  if(ShotCount(0, space) <= LEVELS / 3) {
+    if(space->MonsterGrid[a][b] != -1)
+      ShotFire((space->MonsterGroupeXpos + 7) + (b * 14), ((space->MonsterGroupeYpos + a) * 2) + 1, 0, space);
   }
-  return 0x00;
 }
 
-uint8_t ShieldBlitz(uint8_t Part, uint8_t LineSH) {
-  uint8_t Var0 = 0;
-  switch(LineSH) {
-    case 0: if(Part == 0) Var0 = 0b11110000; else Var0 = 0b00001111; break;
-    case 1: if(Part == 0) Var0 = 0b11111100; else Var0 = 0b00001111; break;
-    case 2:
-    case 3:
-    case 4:
-    case 5: Var0 = 0b00001111; break;
-    case 6: if(Part == 1) Var0 = 0b11111100; else Var0 = 0b00001111; break;
-    case 7: if(Part == 1) Var0 = 0b11110000; else Var0 = 0b00001111; break;
-    default: Var0 = 0b00000000; break;
+// Shot at column VarX on page VarY hits a shield: erode SHIELD_BITE pixels of the
+// column from the side the shot comes from (player from below, monsters from above)
+uint8_t ShieldDestroy(uint8_t Origine, uint8_t VarX, uint8_t VarY, SPACE *space) {
+  uint8_t i = VarX - SHIELD_X;
+  uint8_t n, m;
+  if((VarY != 6) || (i >= SHIELD_W) || (space->Shield[i] == 0)) return 0;
+  for(n=SHIELD_BITE; n && space->Shield[i]; n--) {
+    if(Origine == 0) {
+      for(m=0x80; !(space->Shield[i] & m); m>>=1);
+      space->Shield[i] &= ~m;                 // lowest pixel
+    }
+    else space->Shield[i] &= space->Shield[i] - 1; // topmost pixel
   }
-  return Var0;
+  return 1;
+}
+
+uint8_t MyShield(uint8_t x, uint8_t y, SPACE *space) {
+  uint8_t i = x - SHIELD_X;
+  if((y != 6) || (i >= SHIELD_W)) return 0x00;
+  return space->Shield[i];
 }
 
-uint8_t BOOLREAD(uint8_t SHnum, uint8_t LineSH, SPACE *space) {
-  uint8_t Var0 = 0b10000000 >> LineSH;
-  return((space->Shield[SHnum] & Var0) != 0);
+// Place the three shields into the shield bitmap
+void ShieldReset(SPACE *space) {
+  uint8_t x;
+  for(x=0; x<SHIELD_W; x++) space->Shield[x] = 0x00;
+  for(x=0; x<sizeof(SHIELD); x++) {
+    space->Shield[x] = SHIELD[x];
+    space->Shield[x + SHIELD_GAP] = SHIELD[x];
+    space->Shield[x + 2 * SHIELD_GAP] = SHIELD[x];
+  }
 }
 
+// Advance the explosions, a cell is empty again after the last explosion sprite
 void RemoveExplodOnMonsterGrid(SPACE *space) {
-  uint8_t x, y;
-  for(y=0; y<=3; y++) {
-    for(x=0; x<=5; x++) {
-      if(space->MonsterGrid[y][x] >= 11) space->MonsterGrid[y][x] = -1; 
-      if(space->MonsterGrid[y][x] >= 8)  space->MonsterGrid[y][x] = space->MonsterGrid[y][x] + 1;
+  uint8_t i = 0;
+  while(i < space->ExplodCount) {
+    uint8_t y = space->Explod[i] >> 4;
+    uint8_t x = space->Explod[i] & 0x0F;
+    if(space->MonsterGrid[y][x] < 11) {
+      space->MonsterGrid[y][x]++;
+      i++;
+      continue;
     }
+    space->MonsterGrid[y][x] = -1;
+    space->Explod[i] = space->Explod[--space->ExplodCount];
+    space->RowCount[y]--;
+    space->ColCount[x]--;
+    if(!space->RowCount[y] || !space->ColCount[x]) FormationBounds(space);
   }
 }
 
 uint8_t background(uint8_t x, uint8_t y, SPACE *space) {
-  uint8_t scr = space->ScrBackV + x;
-  if(scr > 127) scr = space->ScrBackV + x - 128;
-  return(0xff - back[y * 128 + scr]);
+  return(0xff - PACK_get(&BackCursor, (space->ScrBackV + x) & 127, y));
 }
 
 uint8_t Vesso(uint8_t x, uint8_t y, SPACE *space) {
@@ -477,115 +548,51 @@ uint8_t Vesso(uint8_t x, uint8_t y, SPACE *space) {
   return 0;
 }
 
-void UFO_Attack_Check(uint8_t x, SPACE *space) {
-  if(space->MyShootBall == 0) {
-    if((space->MyShootBallxpos >= space->UFOxPos) && (space->MyShootBallxpos <= space->UFOxPos + 14)) {
-      for(x=1; x<100; x++) JOY_sound(x, 1);
-      if(Live < 3) Live++;
-      space->UFOxPos =- 120;
-    }
-  }
-}
-
-uint8_t MyShoot(uint8_t x, uint8_t y, SPACE *space) {
-  if((space->MyShootBallxpos == x) && (y == space->MyShootBall)) {
-    if(space->MyShootBall > -1) space->MyShootBallFrame = !space->MyShootBallFrame;
-    else return 0x00;
-    if(space->MyShootBallFrame == 1) space->MyShootBall--;
-    Monster_Attack_Check(space);
-    UFO_Attack_Check(x, space);
-    return SHOOT[space->MyShootBallFrame];
-  }
-  return 0x00;
-}
-
-void Monster_Attack_Check(SPACE *space) {
-  int8_t Varx = 0, Vary = 0;
-  #define Xmouin   (space->MonsterGroupeXpos) 
-  #define Ymouin   (space->MonsterGroupeYpos << 3) //-space->DecalageY8
-  #define XPlus    (Xmouin + 84)
-  #define YPlus    (Ymouin + (4*8))
-  #define MYSHOOTX (space->MyShootBallxpos)
-  #define MYSHOOTY ((space->MyShootBall << 3) + ((space->MyShootBallFrame + 1) << 2))
-  if((MYSHOOTX >= Xmouin) && (MYSHOOTX <= XPlus) && (MYSHOOTY >= Ymouin) && (MYSHOOTY <= YPlus)) {
-    //enter in the monster zone
-    Vary = (MYSHOOTY - Ymouin + 4) >> 3;
-    Varx = (MYSHOOTX - Xmouin + 7) / 14;
-    if(Varx < 0) Varx = 0;
-    if(Vary < 0) Vary = 0;
-    if(Varx > 5) return;
-    if(Vary > 3) return;
-    if((space->MonsterGrid[Vary][Varx] > -1) && (space->MonsterGrid[Vary][Varx] < 6)) {
-      JOY_sound(50, 10);
-      space->MonsterGrid[Vary][Varx] = 8;
-      space->MyShootBall = -1;
-      SpeedControle(space);
-    }
-    //fin monster zone
+uint8_t UFO_Attack_Check(uint8_t x, SPACE *space) {
+  uint8_t i;
+  if((x >= space->UFOxPos) && (x <= space->UFOxPos + 14)) {
+    for(i=1; i<100; i++) JOY_sound(i, 1);
+    if(Live < 3) Live++;
+    space->UFOxPos = -120;
+    return 1;
   }
-}
-
-int8_t OuDansLaGrilleMonster(uint8_t x, uint8_t y, SPACE *space) {
-  if(x < space->MonsterGroupeXpos) return -1;
-  if(y < space->MonsterGroupeYpos) return -1;
-  space->PositionDansGrilleMonsterX = (x - space->MonsterGroupeXpos) / 14;
-  space->PositionDansGrilleMonsterY = (y - space->MonsterGroupeYpos);
-  if(space->PositionDansGrilleMonsterX > 5) return -1;
-  if(space->PositionDansGrilleMonsterY > 4) return -1;
   return 0;
 }
 
-uint8_t SplitSpriteDecalageY(uint8_t Input, uint8_t UPorDOWN, SPACE *space) {
-  if(UPorDOWN) return(Input << space->DecalageY8);
-  else return(Input >> (8 - space->DecalageY8));
+// Sprite of a grid cell, explosions (8..10) are not animated
+const uint8_t* MonsterSprite(int8_t SpriteType, SPACE *space) {
+  if(SpriteType == -1) return 0;
+  if(SpriteType < 8) return &Monsters[(SpriteType + space->anim) * 14];
+  return &Monsters[SpriteType * 14];
 }
 
-uint8_t Murge_Split_UP_DOWN(uint8_t x, SPACE *space) {
-  int8_t SpriteType = -1;
-  int8_t ANIMs = -1;
-  uint8_t Murge1 = 0;
-  uint8_t Murge2 = 0;
-  if(space->DecalageY8 == 0) {
-    SpriteType = space->MonsterGrid[space->PositionDansGrilleMonsterY][space->PositionDansGrilleMonsterX];
-    if(SpriteType < 8) ANIMs = space->anim * 14;
-    else ANIMs = 0;
-    if(SpriteType == -1) return 0x00;
-    return Monsters[(WriteMonster14(x - space->MonsterGroupeXpos) + SpriteType * 14) + ANIMs];
-  }
-  else {
-    //debut
-    if(space->PositionDansGrilleMonsterY == 0) {
-      SpriteType = space->MonsterGrid[space->PositionDansGrilleMonsterY][space->PositionDansGrilleMonsterX];
-      if(SpriteType < 8) ANIMs = space->anim * 14;
-      else ANIMs = 0;
-      if(SpriteType != -1) Murge2 = SplitSpriteDecalageY(Monsters[(WriteMonster14(x - space->MonsterGroupeXpos) + SpriteType * 14) + ANIMs], 1, space);
-      else Murge2 = 0x00;
-      return Murge2;
+// Render the formation part on page y into MonsterLine: the grid rows overlapping
+// the page and their vertical shift are found once, then every column is one span
+// of 14 bytes with the upper row shifted up and the lower row shifted down.
+void MonsterPage(uint8_t y, SPACE *space) {
+  int8_t row = y - space->MonsterGroupeYpos;  // grid row in the lower part of the page
+  uint8_t dec = space->DecalageY8;            // lower row starts this many pixels down
+  uint8_t c, i;
+  MonsterOnPage = (row >= 0) && (row <= FORMATION_ROWS) && (space->MonsterRight >= 0);
+  if(!MonsterOnPage) return;
+  for(c=space->MonsterLeft; c<=space->MonsterRight; c++) {
+    const uint8_t *lo = MonsterSprite(space->MonsterGrid[row][c], space);
+    const uint8_t *hi = ((dec != 0) && (row > 0)) ? MonsterSprite(space->MonsterGrid[row - 1][c], space) : 0;
+    uint8_t *span = &MonsterLine[c * 14];
+    for(i=0; i<14; i++) {
+      uint8_t b = 0;
+      if(lo) b  = lo[i] << dec;
+      if(hi) b |= hi[i] >> (8 - dec);
+      *span++ = b;
     }
-    else {
-      SpriteType = space->MonsterGrid[space->PositionDansGrilleMonsterY - 1][space->PositionDansGrilleMonsterX];
-      if(SpriteType < 8) ANIMs = space->anim * 14;
-      else ANIMs = 0;
-      if(SpriteType != -1) Murge1 = SplitSpriteDecalageY(Monsters[(WriteMonster14(x - space->MonsterGroupeXpos) + SpriteType * 14) + ANIMs], 0, space);
-      else Murge1 = 0x00;
-      SpriteType = space->MonsterGrid[space->PositionDansGrilleMonsterY][space->PositionDansGrilleMonsterX];
-      if(SpriteType < 8) ANIMs = space->anim * 14;
-      else ANIMs = 0;
-      if(SpriteType != -1) Murge2 = SplitSpriteDecalageY(Monsters[(WriteMonster14(x - space->MonsterGroupeXpos) + SpriteType * 14) + ANIMs], 1, space);
-      else Murge2 = 0x00;
-      return(Murge1 | Murge2);
-    }  
-  } //fin
-}
-
-uint8_t WriteMonster14(uint8_t x) {
-  while(x >= 14) x -= 14;
-  return x;
+  }
 }
 
 uint8_t Monster(uint8_t x, uint8_t y, SPACE *space) {
-  if(OuDansLaGrilleMonster(x, y, space) != -1) return  Murge_Split_UP_DOWN(x, space);
-  return 0x00;
+  uint8_t i = x - space->MonsterGroupeXpos;
+  if((!MonsterOnPage) || (x < space->MonsterGroupeXpos)) return 0x00;
+  if((i < space->MonsterLeft * 14) || (i >= (space->MonsterRight + 1) * 14)) return 0x00;
+  return MonsterLine[i];
 }
 
 uint8_t MonsterRefreshMove(SPACE *space) {
@@ -628,27 +635,16 @@ uint8_t MonsterRefreshMove(SPACE *space) {
 }
 
 void VarResetNewLevel(SPACE *space) {
+  uint8_t x;
   ShieldRemoved = 0;
   SpeedShootMonster = 0;
-  MONSTERrest = 24;
   LoadMonstersLevels(LEVELS, space);
-  space->Shield[0] = 255;
-  space->Shield[1] = 255;
-  space->Shield[2] = 255;
-  space->Shield[3] = 255;
-  space->Shield[4] = 255;
-  space->Shield[5] = 255;
-  space->MonsterShoot[0] = 16;
-  space->MonsterShoot[1] = 16;
+  ShieldReset(space);
+  for(x=0; x<SHOTS_MAX; x++) space->ShotY[x] = SHOT_FREE;
   space->UFOxPos = -120;
 
-  space->MyShootBall = -1;
-  space->MyShootBallxpos = 0;
-  space->MyShootBallFrame = 0;
   space->anim = 0;
   space->frame = 0;
-  space->PositionDansGrilleMonsterX = 0;
-  space->PositionDansGrilleMonsterY = 0;
   space->MonsterFloorMax = 3;
   space->MonsterOffsetGauche = 0;
   space->MonsterOffsetDroite = 44;
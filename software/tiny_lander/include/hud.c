@@ -0,0 +1,37 @@
+// ===================================================================================
+// HUD Widgets for SSD1306 OLED                                               * v1.0 *
+// ===================================================================================
+
+#include "hud.h"
+
+// Set rectangle, draw function and its context of a widget
+void HUD_init(HUD_widget* w, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,
+              uint8_t (*draw)(uint8_t x, uint8_t y, void* ctx), void* ctx) {
+  w->x0    = x0;
+  w->y0    = y0;
+  w->x1    = x1;
+  w->y1    = y1;
+  w->draw  = draw;
+  w->ctx   = ctx;
+  w->valid = 0;
+}
+
+// Show value, redraw only if it changed
+void HUD_set(HUD_widget* w, uint16_t value) {
+  if(w->valid && (w->value == value)) return;
+  w->value = value;
+  w->valid = 1;
+  HUD_draw(w);
+}
+
+// Send the bytes of the rectangle, the window wraps them from page to page
+void HUD_draw(HUD_widget* w) {
+  uint8_t x, y;
+  OLED_window(w->x0, w->y0, w->x1, w->y1);
+  OLED_data_start();
+  for(y = w->y0; y <= w->y1; y++) {
+    for(x = w->x0; x <= w->x1; x++) I2C_write(w->draw(x, y, w->ctx));
+  }
+  I2C_stop();
+  OLED_window(0, 0, 127, 7);              // back to the whole screen
+}
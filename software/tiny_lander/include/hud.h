@@ -0,0 +1,54 @@
+// ===================================================================================
+// HUD Widgets for SSD1306 OLED                                               * v1.0 *
+// ===================================================================================
+//
+// A widget owns a rectangle of the screen (columns x0..x1, pages y0..y1) and shows a
+// single value in it. The game supplies a draw function that returns the screen byte
+// for every column and page of the rectangle, the same way the full screen renderer
+// composes its bytes. HUD_set() redraws the rectangle only if the value differs from
+// the one on the screen, and sends just the bytes of the rectangle through an OLED
+// window instead of the whole screen:
+//
+//   uint8_t ScoreDraw(uint8_t x, uint8_t y, void* ctx) {...}
+//   HUD_widget ScoreHUD;
+//   HUD_init(&ScoreHUD, 1, 1, 20, 1, ScoreDraw, &score);
+//   HUD_set(&ScoreHUD, score);
+//
+// Functions available:
+// --------------------
+// HUD_init(w, x0, y0, x1, y1, draw, ctx)
+//                          Set rectangle, draw function and its context of widget w
+// HUD_set(w, value)        Show value in widget w, redraws only if it changed
+// HUD_invalidate(w)        Redraw widget w with the next HUD_set(), call it after
+//                          the screen was drawn by other means
+// HUD_draw(w)              Redraw widget w now
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "oled_min.h"
+
+// Widget
+typedef struct HUD_widget {
+  uint8_t  x0, y0, x1, y1;                        // rectangle, columns and pages
+  uint8_t  (*draw)(uint8_t x, uint8_t y, void* ctx); // screen byte at x, y
+  void*    ctx;                                   // passed to draw
+  uint16_t value;                                 // value on the screen
+  uint8_t  valid;                                 // value is on the screen
+} HUD_widget;
+
+// Functions
+void HUD_init(HUD_widget* w, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,
+              uint8_t (*draw)(uint8_t x, uint8_t y, void* ctx), void* ctx);
+void HUD_set(HUD_widget* w, uint16_t value);
+void HUD_draw(HUD_widget* w);
+
+#define HUD_invalidate(w)   (w)->valid = 0
+
+#ifdef __cplusplus
+};
+#endif
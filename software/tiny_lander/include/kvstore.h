@@ -0,0 +1,59 @@
+// ===================================================================================
+// Key-Value Store in Flash for CH32V003                                      * v1.0 *
+// ===================================================================================
+//
+// Keeps up to KV_KEYS 16-bit values (high scores, settings, progress) in the record
+// log of flashlog.h. All values are cached in RAM: KV_init() replays the log once on
+// start, after that KV_get() and KV_set() only touch the cache.
+//
+// Keys are stored in pairs, one log record per pair holds the pair number and both
+// values. KV_commit() appends one 8-byte record for each pair that was changed, so
+// a page erase now covers up to eight commits of a single pair instead of one.
+// The newest record of a pair wins, older ones are left behind as garbage.
+//
+// Before the log enters a page it erases it, so the live records of the page after
+// the one being written are copied forward first (compaction). This is done before
+// every append until that page holds nothing live, which also finishes a copy that
+// was cut short by a power loss. A cut write leaves a slot that is skipped, so
+// KV_PAIRS is kept two below the records per page: the copies fit into the current
+// page even if two writes into it were cut short.
+//
+// Functions available:
+// --------------------
+// KV_init()                Replay the log and cache the newest value of every key
+// KV_get(key)              Return value of key (KV_EMPTY if it was never set)
+// KV_set(key, val)         Set value of key in the cache
+// KV_commit()              Write the changed pairs to flash,
+//                          returns 0 if a record could not be written
+//
+// Keys are 0..KV_KEYS-1. The driver uses the first keys for its own settings
+// (JOY_KEY_*), every game defines its keys from JOY_KEY_GAME on. The log pages must
+// be kept out of the FLASH memory area in the linker script.
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "flashlog.h"
+
+// Store parameters
+#define KV_KEYS           12          // number of 16-bit values
+#define KV_PAIRS          (KV_KEYS / 2) // number of records holding live values
+#define KV_EMPTY          0xFFFF      // value of keys that were never set
+
+#if KV_PAIRS > FLASH_PAGE_SIZE / 8 - 2
+#error "KV_PAIRS must stay two below the records per log page"
+#endif
+
+// Functions
+void KV_init(void);
+uint16_t KV_get(uint8_t key);
+void KV_set(uint8_t key, uint16_t val);
+uint8_t KV_commit(void);
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,87 @@
+// ===================================================================================
+// Packed Bitmap Decoder for SSD1306 Full-Screen Images                       * v1.0 *
+// ===================================================================================
+//
+// LZ packet headers (see tools/bmppack.py):
+// - 0x00..0x7F: literal, the next (n + 1) bytes are copied to the output
+// - 0x80..0xBF: run, the next byte is repeated (n - 0x80 + 3) times
+// - 0xC0..0xFF: copy, (n - 0xC0 + 3) bytes are copied from (next byte + 1) bytes back
+//
+// Indexed RLE packet headers (bmppack.py -i), preceded by 8 x 16-bit page offsets and
+// a run directory of 3 packet offsets per page, for the columns 32, 64 and 96:
+// - 0x00..0x7F: literal, the next (n + 1) bytes
+// - 0x80..0xFF: run, the next byte is repeated (n - 0x80 + 2) times
+
+#include "pack.h"
+#include "oled_min.h"
+
+// Start decoding packed bitmap
+void PACK_start(PACK_stream* s, const uint8_t* pak) {
+  s->src = pak;
+  s->cnt = 0;
+  s->pos = 0;
+}
+
+// Return next decoded byte
+uint8_t PACK_read(PACK_stream* s) {
+  uint8_t b;
+  if(!s->cnt) {                                 // start of a new packet?
+    s->hdr = *s->src++;                         // read header
+    if(s->hdr < 0x80) s->cnt = s->hdr + 1;      // literal
+    else {
+      s->cnt = (s->hdr & 0x3F) + 3;             // run or copy
+      if(s->hdr >= 0xC0) s->dist = *s->src++ + 1;
+    }
+  }
+  s->cnt--;
+  if(s->hdr < 0x80) b = *s->src++;             // literal: next byte
+  else if(s->hdr < 0xC0) {                      // run: same byte again
+    b = *s->src;
+    if(!s->cnt) s->src++;
+  }
+  else b = s->win[(uint8_t)(s->pos - s->dist) & 0x7F]; // copy: byte from window
+  s->win[s->pos++ & 0x7F] = b;                  // remember byte for later copies
+  return b;
+}
+
+// Decode packed bitmap page by page to the OLED
+void PACK_draw(const uint8_t* pak) {
+  PACK_stream s;
+  PACK_start(&s, pak);
+  for(uint8_t y = 0; y < 8; y++) {
+    OLED_setpos(0, y);
+    OLED_data_start();
+    for(uint8_t x = 128; x; x--) OLED_send_byte(PACK_read(&s));
+    OLED_data_stop();
+  }
+}
+
+// Return number of bytes of indexed RLE packet
+static inline uint8_t PACK_length(uint8_t hdr) {
+  return (hdr < 0x80) ? (hdr + 1) : (hdr - 0x80 + 2);
+}
+
+// Attach cursor to indexed RLE bitmap
+void PACK_open(PACK_cursor* c, const uint8_t* pak) {
+  c->pak  = pak;
+  c->page = 0xFF;                               // force seek on first lookup
+}
+
+// Return byte at column x, page y of indexed RLE bitmap
+uint8_t PACK_get(PACK_cursor* c, uint8_t x, uint8_t y) {
+  uint8_t seg = x >> PACK_SEG_SHIFT;
+  if((y != c->page) || (x < c->start) || (seg != (c->start >> PACK_SEG_SHIFT))) {
+    c->page  = y;                               // restart at segment of column x
+    c->src   = c->pak + c->pak[y << 1] + ((uint16_t)c->pak[(y << 1) + 1] << 8);
+    if(seg) c->src += c->pak[16 + (y << 1) + y + seg - 1];
+    c->start = seg << PACK_SEG_SHIFT;
+    c->end   = c->start + PACK_length(*c->src);
+  }
+  while(x >= c->end) {                          // skip packets up to column x
+    c->src  += (*c->src < 0x80) ? (*c->src + 2) : 2;
+    c->start = c->end;
+    c->end  += PACK_length(*c->src);
+  }
+  if(*c->src < 0x80) return c->src[1 + x - c->start]; // literal
+  return c->src[1];                                     // run
+}
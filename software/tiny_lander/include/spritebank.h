@@ -28,14 +28,17 @@ extern "C" {
 #endif
 
 #define NUMOFGAMES 10
+#define MAPWIDTH 104
+#define MAPSAMPLES 27
+#define MAPHEIGHT 63
+#define MAPOFFSET 23
+#define PADTOUCH 58
 #define VLimit 100
-#define MoveY 35
-#define MoveX 35
+#define MOVESCALE 7
 #define TrustY 1
 #define TrustX 1
 #define GRAVITYDECY 1
 #define FULLTHRUST 18
-#define ACCELERATOR 45
 #define LANDINGSPEED 35
 #define BONUSSPEED1 13
 #define BONUSSPEED2 24
@@ -116,8 +119,8 @@ typedef struct GAME {
 
   short velocityY;
   short velocityX;
-  uint16_t velXCounter;
-  uint16_t velYCounter;
+  uint8_t ShipFracX;
+  uint8_t ShipFracY;
 
   bool Toggle;
   uint8_t ShipExplode;
@@ -192,72 +195,33 @@ const uint8_t LIVE[] = {
   0x60, 0x18, 0x18, 0x60, 0x00
 };
 
-// 'Tiny Lander Intro', 128x64px
+// 'Tiny Lander Intro', 128x64px, LZ packed with tools/bmppack.py
 const uint8_t INTRO[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1e, 0x30, 0x1e, 0x00, 0x00, 0x3e, 0x00, 0x20, 0x00, 0x3e, 0x22, 0x3e, 0x00, 
-  0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xfc, 0xfc, 0xfc, 0xfc, 0xb8, 0x80, 
-  0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0x82, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0x03, 0x03, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 
-  0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x1c, 0xf8, 0xf8, 0xf0, 0x00, 0x1c, 0xfc, 0xfc, 0xf8, 
-  0x00, 0xc0, 0xfc, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0x3f, 0xff, 
-  0xf0, 0xff, 0x7f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x87, 0xff, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 
-  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xfc, 0xfc, 0xfc, 0xfc, 0x7c, 0x7c, 
-  0x7e, 0xff, 0xff, 0x7f, 0x7f, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 
-  0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0x80, 
-  0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x80, 0xc0, 
-  0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0xc0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0x78, 
-  0x3e, 0x0f, 0x07, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xdf, 
-  0xaf, 0xdf, 0xaf, 0xdf, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1f, 0x07, 
-  0x0f, 0x1e, 0x78, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe3, 0xf3, 0xf3, 
-  0x38, 0x1c, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0xff, 
-  0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x01, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 
-  0x19, 0x18, 0x19, 0x9f, 0x9f, 0x9f, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0x3e, 0x1f, 0x0d, 0x0c, 
-  0x04, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xc1, 0xf1, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xf1, 0xc1, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x06, 
-  0x06, 0x04, 0x0c, 0x0d, 0x1f, 0x3e, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x03, 0x07, 0x0f, 0x0f, 
-  0x0c, 0x04, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 
-  0x00, 0x00, 0x03, 0x07, 0x0f, 0x0e, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0x07, 0x0f, 
-  0x0e, 0x0c, 0x0e, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x0c, 0x1c, 0x1e, 0x1f, 0x1f, 0x0c, 0x0c, 0x04, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x0c, 0x1f, 0x1f, 0x1e, 0x1c, 0x0c, 0x0c, 0x04, 0x00, 0x00
+  0xBF, 0x00, 0xE0, 0x00, 0x00, 0x80, 0xCA, 0x0D, 0x0C, 0x1E, 0x30, 0x1E, 0x00, 0x00, 0x3E, 0x00,
+  0x20, 0x00, 0x3E, 0x22, 0x3E, 0x00, 0xC0, 0x1C, 0xC5, 0x00, 0xC2, 0x09, 0xFF, 0x6C, 0xC4, 0x00,
+  0x00, 0xB8, 0x81, 0xFC, 0x00, 0xB8, 0xC3, 0x59, 0x01, 0xFF, 0x82, 0xD6, 0x58, 0x01, 0x00, 0x00,
+  0x80, 0x03, 0x80, 0xFF, 0xC0, 0x05, 0x00, 0x00, 0x81, 0xFD, 0x01, 0x00, 0x00, 0xC0, 0x36, 0x80,
+  0x1C, 0x0C, 0xF8, 0xF8, 0xF0, 0x00, 0x1C, 0xFC, 0xFC, 0xF8, 0x00, 0xC0, 0xFC, 0xFC, 0x3C, 0xEA,
+  0x78, 0x07, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0x7F, 0x83, 0x3F, 0x00, 0x7F, 0x86, 0xFF,
+  0x05, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0xCD, 0x2D, 0xC2, 0x00, 0xC0, 0x1D, 0xC4, 0x06, 0xC0,
+  0x07, 0xC3, 0x0C, 0xC2, 0x05, 0x06, 0x03, 0x3F, 0xFF, 0xF0, 0xFF, 0x7F, 0x03, 0xAB, 0x00, 0xC2,
+  0x6C, 0x00, 0x81, 0xC7, 0x0F, 0x00, 0x81, 0xC3, 0x10, 0x02, 0x81, 0x81, 0x87, 0xC3, 0x5F, 0xCB,
+  0x00, 0xDA, 0x00, 0x80, 0x07, 0x01, 0x03, 0x01, 0xAD, 0x00, 0x07, 0x03, 0x07, 0x0F, 0x1F, 0x3F,
+  0x7F, 0xFF, 0xFE, 0x81, 0xFC, 0x04, 0x7C, 0x7C, 0x7E, 0xFF, 0xFF, 0x81, 0x7F, 0xC0, 0x79, 0x05,
+  0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0xCD, 0x2D, 0xC0, 0x00, 0x81, 0xF8, 0xC3, 0x09, 0x00, 0x80,
+  0x83, 0xC0, 0x02, 0x80, 0x00, 0x00, 0xC1, 0x05, 0xC1, 0x0D, 0xC0, 0x0A, 0x00, 0x00, 0xC2, 0x08,
+  0xC3, 0x23, 0xC3, 0x20, 0xC1, 0x14, 0xC0, 0x06, 0xC1, 0x0D, 0xCB, 0x49, 0x06, 0x80, 0xE0, 0x78,
+  0x3E, 0x0F, 0x07, 0x1F, 0xC1, 0x6D, 0xC3, 0x00, 0x01, 0xAF, 0xDF, 0xC2, 0x01, 0xC5, 0x0E, 0x06,
+  0x7F, 0x1F, 0x07, 0x0F, 0x1E, 0x78, 0xE0, 0xC1, 0x3F, 0xC5, 0x00, 0xC0, 0x00, 0xC1, 0x19, 0xC2,
+  0x08, 0x05, 0xC0, 0xE3, 0xF3, 0xF3, 0x38, 0x1C, 0xC2, 0x0D, 0xC1, 0x13, 0x01, 0x01, 0x01, 0xC5,
+  0x0A, 0x00, 0x03, 0xC7, 0x0A, 0x02, 0x19, 0x18, 0x19, 0x80, 0x9F, 0xC2, 0x0A, 0x00, 0x07, 0x80,
+  0x03, 0xC9, 0x7B, 0x08, 0xF8, 0x3E, 0x1F, 0x0D, 0x0C, 0x04, 0x06, 0x06, 0x03, 0xC0, 0x2E, 0xC2,
+  0x00, 0x01, 0xC1, 0xF1, 0xC3, 0x76, 0x01, 0xF1, 0xC1, 0xC4, 0x10, 0x0B, 0x03, 0x03, 0x06, 0x06,
+  0x04, 0x0C, 0x0D, 0x1F, 0x3E, 0xF8, 0xE0, 0x80, 0xC4, 0x36, 0xC0, 0x00, 0x81, 0x0F, 0x81, 0x0E,
+  0x06, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x0C, 0x04, 0xC0, 0x0D, 0xC3, 0x13, 0xC2, 0x05, 0x00, 0x00,
+  0xC1, 0x15, 0x02, 0x0E, 0x0C, 0x0C, 0xC7, 0x0A, 0x02, 0x0E, 0x0F, 0x07, 0xC0, 0x76, 0xC2, 0x0F,
+  0xC4, 0x00, 0x09, 0x04, 0x0C, 0x0C, 0x1C, 0x1E, 0x1F, 0x1F, 0x0C, 0x0C, 0x04, 0x8B, 0x00, 0x87,
+  0x01, 0xCB, 0x17, 0xC0, 0x2F, 0x03, 0x1F, 0x1F, 0x1E, 0x1C, 0xC2, 0x2F
 };
 
 #ifdef __cplusplus
@@ -32,6 +32,17 @@
 #include "driver.h"
 #include "spritebank.h"
 
+// ===================================================================================
+// Global Variables
+// ===================================================================================
+uint8_t LandFloor[MAPWIDTH];    // top of the floor per column, MAPHEIGHT: landing pad
+uint8_t LandCeiling[MAPWIDTH];  // bottom of the ceiling per column
+uint16_t MapSeed;               // random generator of the generated levels
+
+#define CONTACT_NONE  0
+#define CONTACT_CRASH 1
+#define CONTACT_PAD   2
+
 // ===================================================================================
 // Function Prototypes
 // ===================================================================================
@@ -39,8 +50,9 @@ void initGame(GAME * game);
 void showAllScoresAndBonuses(GAME *game, DIGITAL *score, DIGITAL *velX, DIGITAL *velY);
 void changeSpeed(GAME * game);
 void moveShip(GAME * game);
+uint8_t ShipContact(GAME * game);
 void fillData(long myValue, DIGITAL * data);
-void SetLandingMap(uint8_t level, GAME *game);
+void SetLandingMap(const uint8_t *floor, GAME *game);
 uint8_t ScoreDisplay(uint8_t x, uint8_t y, DIGITAL * score);
 uint8_t VelocityDisplay(uint8_t x, uint8_t y, DIGITAL * velocity, uint8_t horizontal);
 uint8_t DashboardDisplay(uint8_t x, uint8_t y, GAME * game);
@@ -50,6 +62,8 @@ uint8_t FuelDisplay(uint8_t x, uint8_t y, GAME * game);
 uint8_t GameDisplay(uint8_t x, uint8_t y, GAME * game);
 uint8_t StarsDisplay(uint8_t x, uint8_t y, GAME * game);
 uint8_t LivesDisplay(uint8_t x, uint8_t y, GAME * game);
+uint8_t ScoreHUDDraw(uint8_t x, uint8_t y, void * ctx);
+uint8_t StarsHUDDraw(uint8_t x, uint8_t y, void * ctx);
 void Tiny_Flip(uint8_t mode, GAME * game, DIGITAL * score, DIGITAL * velX, DIGITAL * velY);
 
 void INTROJOY_sound(void);
@@ -57,8 +71,13 @@ void VICTORYJOY_sound(void);
 void ALERTJOY_sound(void);
 void HAPPYJOY_sound(void);
 void SPLITDIGITS(uint16_t val, uint8_t *digits);
-uint8_t GETLANDSCAPE(uint8_t x, uint8_t y, uint8_t level, GAME *game);
+void LOADLEVEL(uint8_t level, uint8_t map[2][MAPSAMPLES], uint8_t *param);
+void GENLEVEL(uint8_t level, uint8_t map[2][MAPSAMPLES], uint8_t *param);
+uint8_t MAPRANDOM(uint8_t n);
+void SETLANDSCAPE(uint8_t level, GAME *game, uint8_t *param);
+uint8_t GETLANDSCAPE(uint8_t x, uint8_t y);
 void SETNEXTLEVEL(uint8_t level, GAME *game);
+uint8_t SuspendGame(uint8_t mode, GAME *game);
 
 // ===================================================================================
 // Main Function
@@ -75,6 +94,12 @@ int main(void) {
     DIGITAL velY;
     GAME game;
 
+    if (SuspendGame(SUSPEND_LOAD, &game)) {
+      uint8_t param[5];
+      SETLANDSCAPE(game.Level, &game, param);
+      goto RESUME;
+    }
+
   BEGIN:
     game.Level = 1;
     game.Score = 0;
@@ -102,6 +127,7 @@ int main(void) {
   START:
     initGame(&game);
     INTROJOY_sound();
+  RESUME:
     while(1) {
       fillData(game.Score, &score);
       fillData(game.velocityX, &velX);
@@ -130,6 +156,11 @@ int main(void) {
         game.EndCounter++;
       if (game.HasLanded)
         game.EndCounter = 10;
+      if (JOY_suspend_due())
+      {
+        SuspendGame(SUSPEND_SAVE, &game);
+        JOY_sleep();
+      }
       JOY_SLOWDOWN();
     }
   }
@@ -138,14 +169,22 @@ int main(void) {
 // ===================================================================================
 // Functions
 // ===================================================================================
+uint8_t SuspendGame(uint8_t mode, GAME *game)
+{
+  if (!SUSPEND_begin(mode, 'L'))
+    return 0;
+  SUSPEND_var(*game);
+  return SUSPEND_end();
+}
+
 void initGame(GAME * game)
 {
   SETNEXTLEVEL(game->Level, game);
 
   game->velocityY = 0;
   game->velocityX = 0;
-  game->velXCounter = 0;
-  game->velYCounter = 0;
+  game->ShipFracX = 0;
+  game->ShipFracY = 0;
   game->ShipExplode = 0;
   game->Toggle = true;
   game->Collision = false;
@@ -169,20 +208,26 @@ void showAllScoresAndBonuses(GAME *game, DIGITAL *score, DIGITAL *velX, DIGITAL
   if (game->Fuel >= game->FuelBonus)
     bonusPoints++;
 
+  // the stars and the score are redrawn as HUD widgets, not as full screens
+  HUD_widget hud;
+  game->Stars = 0;
+  Tiny_Flip(2, game, score, velX, velY);
+  HUD_init(&hud, 41, 2, 111, 4, StarsHUDDraw, game);
   for (game->Stars = 1; game->Stars <= bonusPoints; game->Stars++)
   {
-    Tiny_Flip(2, game, score, velX, velY);
+    HUD_set(&hud, game->Stars);
     HAPPYJOY_sound();
     JOY_DLY_ms(500);
   }
   game->Stars--;
 
+  HUD_init(&hud, SCOREOFFSET, 1, SCOREOFFSET + (SCOREDIGITS * DIGITSIZE) - 1, 1, ScoreHUDDraw, score);
   uint16_t newScore = game->Score + game->LevelScore  + (game->LevelScore * bonusPoints );
   while (game->Score < newScore)
   {
     game->Score++;
     fillData(game->Score, score);
-    Tiny_Flip(2, game, score, velX, velY);
+    HUD_set(&hud, game->Score);
     JOY_sound(129, 2);
   }
 }
@@ -229,41 +274,88 @@ void changeSpeed(GAME * game)
 
 void moveShip(GAME * game)
 {
-  if (game->ShipExplode > 0 || game->Collision || game->HasLanded) return;
-
-  game->velXCounter += abs(game->velocityX);
-  game->velYCounter += abs(game->velocityY);
-
-  if ((game->velXCounter) >= MoveX) {
-    game->velXCounter = 0;
-    if ((game->velocityX) > 0)
-      game->ShipPosX += 1;
-    if ((game->velocityX) < 0)
-      game->ShipPosX -= 1;
+  if (game->ShipExplode > 0)
+  {
+    // about as long as the former crackle per rendered column
+    JOY_sound(20 * game->ShipExplode, 70);
+    (game->ShipExplode)--;
+    if (game->ShipExplode < 1)
+      game->ShipExplode = 3;
+    return;
   }
+  if (game->Collision || game->HasLanded) return;
 
-  if (game->velYCounter >= MoveY) {
-    uint8_t inc = (abs(game->velocityY) / ACCELERATOR) + 1;
-    (game->velYCounter) = 0;
-    if ((game->velocityY) > 0)
-      game->ShipPosY -= inc;
-    if (game->velocityY < 0)
-      game->ShipPosY += inc;
-  }
+  // Q8.8 position, velocity units move MOVESCALE/256 pixels per step
+  int16_t targetX = ((game->ShipPosX << 8) | game->ShipFracX) + game->velocityX * MOVESCALE;
+  int16_t targetY = ((game->ShipPosY << 8) | game->ShipFracY) - game->velocityY * MOVESCALE;
 
   // boundaries....
-  if (game->ShipPosX > 121)
+  if (targetX > (121 << 8))
+    targetX = (121 << 8);
+  else if (targetX < (MAPOFFSET << 8))
+    targetX = (MAPOFFSET << 8);
+  if (targetY > (55 << 8))
+    targetY = (55 << 8);
+  else if (targetY < 0)
+    targetY = 0;
+  game->ShipFracX = targetX & 0xFF;
+  game->ShipFracY = targetY & 0xFF;
+  targetX >>= 8;
+  targetY >>= 8;
+
+  // sweep pixel by pixel, so that the ship cannot pass through thin terrain
+  uint8_t contact = ShipContact(game);
+  while (contact == CONTACT_NONE && (game->ShipPosX != targetX || game->ShipPosY != targetY))
+  {
+    if (game->ShipPosX != targetX)
+      game->ShipPosX += (targetX > game->ShipPosX) ? 1 : -1;
+    if (game->ShipPosY != targetY)
+      game->ShipPosY += (targetY > game->ShipPosY) ? 1 : -1;
+    contact = ShipContact(game);
+  }
+
+  if (contact == CONTACT_PAD && abs(game->velocityY) <= LANDINGSPEED && (game->ShipPosX >= game->LandingPadLEFT + MAPOFFSET) && (game->ShipPosX + 7 <= game->LandingPadRIGHT + MAPOFFSET))
   {
-    game->ShipPosX = 121;
+    game->HasLanded = true;
   }
-  else if (game->ShipPosX < 23)
+  else if (contact != CONTACT_NONE)
   {
-    game->ShipPosX = 23;
+    game->Lives--;
+    game->ShipExplode = 3;
+    game->Collision = true;
   }
-  if (game->ShipPosY > 55)
+}
+
+// tests the lander at its position against the border lines and the terrain cache
+uint8_t ShipContact(GAME * game)
+{
+  uint8_t i;
+  uint8_t contact = CONTACT_NONE;
+  if (game->ShipPosX <= MAPOFFSET || game->ShipPosX + 6 >= MAPOFFSET + MAPWIDTH)
+    return CONTACT_CRASH;
+  for (i = 0; i < 7; i++)
   {
-    game->ShipPosY = 55;
+    // top and bottom row of body and legs in this column
+    uint8_t mask = LANDER[i] | LANDER[i + 7];
+    uint8_t top = 0;
+    uint8_t bottom = 7;
+    while (!(mask & (1 << top))) top++;
+    while (!(mask & (1 << bottom))) bottom--;
+    top += game->ShipPosY;
+    bottom += game->ShipPosY;
+
+    uint8_t col = game->ShipPosX + i - MAPOFFSET;
+    if (top <= LandCeiling[col])
+      return CONTACT_CRASH;
+    if (col >= game->LandingPadLEFT && col <= game->LandingPadRIGHT)
+    {
+      if (bottom >= PADTOUCH)
+        contact = CONTACT_PAD;
+    }
+    else if (bottom >= LandFloor[col])
+      return CONTACT_CRASH;
   }
+  return contact;
 }
 
 void fillData(long myValue, DIGITAL * data)
@@ -332,14 +424,7 @@ uint8_t getLanderSprite(uint8_t x, uint8_t y, GAME * game)
   uint8_t sprite = 0x00;
 
   if (game->ShipExplode > 0)
-  {
-    sprite = (LANDER[(x - game->ShipPosX) + ((8 - (game->ShipExplode)) * 7) ]);
-    JOY_sound(20 * game->ShipExplode, 10);
-    (game->ShipExplode)--;
-    if (game->ShipExplode < 1)
-      game->ShipExplode = 3;
-    return sprite;
-  }
+    return (LANDER[(x - game->ShipPosX) + ((8 - (game->ShipExplode)) * 7) ]);
 
   // top sprite (4 bit)
   if (game->ThrustLEFT)
@@ -372,49 +457,17 @@ uint8_t FuelDisplay(uint8_t x, uint8_t y, GAME * game)
 
 uint8_t GameDisplay(uint8_t x, uint8_t y, GAME * game)
 {
-  const uint8_t offset = 23;
-  if (x >= offset)
+  if (x >= MAPOFFSET)
   {
     uint8_t frame;
-    if (x == offset || x == 127)
+    if (x == MAPOFFSET || x == 127)
       // left and right border-line
       frame = 0xFF;
     else
-      // draw the map from the coordinates given by the GAMEMAP
-      frame = GETLANDSCAPE(x - offset, y, ((game->Level - 1) * 2), game);
-
-    uint8_t ship = LanderDisplay(x, y, game);
-
-    if (y == 7 && x >= (game->LandingPadLEFT + offset) && x <= (game->LandingPadRIGHT + offset))
-    {
-      if (ship != 0 && (0xFC | ship) != (0xFC + ship))
-      {
-        if (abs(game->velocityY) <= LANDINGSPEED && (game->ShipPosX >= game->LandingPadLEFT + offset) && (game->ShipPosX + 7 <= game->LandingPadRIGHT + offset) )
-        {
-          game->HasLanded = true;
-          return frame | ship;
-        }
-        else
-        {
-          if (!game->Collision)
-            game->Lives--;
-          game->ShipExplode = 3;
-          game->Collision = true;
-
-          return frame | LanderDisplay(x, y, game);
-        }
-      }
-    }
-    else if  ((frame != 0 && ship != 0) && (frame | ship) != (frame + ship))
-    {
-      if (!game->Collision)
-        game->Lives--;
-      game->ShipExplode = 3;
-      game->Collision = true;
-      return frame | LanderDisplay(x, y, game);
-    }
+      // draw the map from the terrain cache
+      frame = GETLANDSCAPE(x - MAPOFFSET, y);
 
-    return frame | ship;
+    return frame | LanderDisplay(x, y, game);
   }
   return 0x00;
 }
@@ -469,8 +522,22 @@ uint8_t LivesDisplay(uint8_t x, uint8_t y, GAME * game)
   return 0x00;
 }
 
+uint8_t ScoreHUDDraw(uint8_t x, uint8_t y, void * ctx)
+{
+  return DashboardDisplay(x, y, 0) | ScoreDisplay(x, y, (DIGITAL *)ctx);
+}
+
+uint8_t StarsHUDDraw(uint8_t x, uint8_t y, void * ctx)
+{
+  return StarsDisplay(x, y, (GAME *)ctx);
+}
+
 void Tiny_Flip(uint8_t mode, GAME * game, DIGITAL * score, DIGITAL * velX, DIGITAL * velY) {
   uint8_t y, x;
+  if (mode == 1) {
+    JOY_OLED_draw_packed(INTRO);
+    return;
+  }
   for (y = 0; y < 8; y++)
   {
     JOY_OLED_data_start(y);
@@ -478,8 +545,6 @@ void Tiny_Flip(uint8_t mode, GAME * game, DIGITAL * score, DIGITAL * velX, DIGIT
     {
       if (mode == 0) {
         JOY_OLED_send(GameDisplay(x, y, game) | LivesDisplay(x, y, game) | DashboardDisplay(x, y, game) | ScoreDisplay(x, y, score) | VelocityDisplay(x, y, velX, 1) | VelocityDisplay(x, y, velY, 0) | FuelDisplay(x, y, game));
-      } else if (mode == 1) {
-        JOY_OLED_send((INTRO[x + (y * 128)]));
       }
       else if (mode == 2)
       {
@@ -490,15 +555,15 @@ void Tiny_Flip(uint8_t mode, GAME * game, DIGITAL * score, DIGITAL * velX, DIGIT
   }
 }
 
-void SetLandingMap(uint8_t level, GAME *game)
+void SetLandingMap(const uint8_t *floor, GAME *game)
 {
   uint8_t i;
   uint8_t prev;
   game->LandingPadLEFT = 0;
   game->LandingPadRIGHT = 255;
-  for (i = 0; i < 27; i++)
+  for (i = 0; i < MAPSAMPLES; i++)
   {
-    uint8_t val = (GAMEMAP[(level - 1) * 2][i]);
+    uint8_t val = floor[i];
 
     if ((prev == 0 && (val != 0 || i == 26)) && game->LandingPadRIGHT == 0)
     {
@@ -517,57 +582,165 @@ void SetLandingMap(uint8_t level, GAME *game)
 
 void SETNEXTLEVEL(uint8_t level, GAME *game)
 {
-  if ( level > NUMOFGAMES)
+  uint8_t param[5];
+  if (level == 0)
     level = 1;
   game->Level = level;
-  SetLandingMap(level, game);
-  game->ShipPosX = (GAMELEVEL[level - 1][0]);
-  game->ShipPosY = (GAMELEVEL[level - 1][1]);
-  game->Fuel = 100 * (GAMELEVEL[level - 1][2]);
-  game->LevelScore = (GAMELEVEL[level - 1][3]);
-  game->FuelBonus = 100 * (GAMELEVEL[level - 1][4]);
+  SETLANDSCAPE(level, game, param);
+  game->ShipPosX = param[0];
+  game->ShipPosY = param[1];
+  game->Fuel = 100 * param[2];
+  game->LevelScore = param[3];
+  game->FuelBonus = 100 * param[4];
 }
 
-uint8_t GETLANDSCAPE(uint8_t x, uint8_t y, uint8_t level, GAME *game)
+// copies the samples and parameters of a GAMEMAP level, the levels after
+// NUMOFGAMES are generated
+void LOADLEVEL(uint8_t level, uint8_t map[2][MAPSAMPLES], uint8_t *param)
 {
-  const uint8_t height = 63;
-  uint8_t frame = 0x00;
-  uint8_t t =  x % 4;
-  uint8_t ind = x / 4;
-  uint8_t val = height - (GAMEMAP[level][ind]);
-  uint8_t valT = height - (GAMEMAP[level + 1][ind]);
-  if (x > 0 && t != 0)
+  uint8_t i;
+  if (level > NUMOFGAMES)
+  {
+    GENLEVEL(level, map, param);
+    return;
+  }
+  for (i = 0; i < MAPSAMPLES; i++)
+  {
+    map[0][i] = GAMEMAP[(level - 1) * 2][i];
+    map[1][i] = GAMEMAP[(level - 1) * 2 + 1][i];
+  }
+  for (i = 0; i < 5; i++)
+    param[i] = GAMELEVEL[level - 1][i];
+}
+
+// random number 0..n-1 of the level generator
+uint8_t MAPRANDOM(uint8_t n)
+{
+  MapSeed = (MapSeed >> 0x01) ^ (-(MapSeed & 0x01) & 0xB400);
+  return MapSeed % n;
+}
+
+// generates the samples and parameters of a level from its number, so that
+// every level looks the same each time it is played. The floor is a random
+// walk that gets higher and rougher, the landing pad narrower and the fuel
+// shorter with every level. Stalactites hang from the ceiling from the third
+// generated level on, always leaving room for the ship above the floor.
+void GENLEVEL(uint8_t level, uint8_t map[2][MAPSAMPLES], uint8_t *param)
+{
+  uint8_t i;
+  uint8_t d = level - NUMOFGAMES;           // difficulty
+  if (d > 20)
+    d = 20;
+  MapSeed = 0xACE1 ^ (level * 0x9E37);
+  if (MapSeed == 0)
+    MapSeed = 1;
+
+  // landing pad (3 or 2 samples) and start on the other half of the map, the
+  // last sample stays floor so the pad ends inside the map and the ship fits on it
+  uint8_t padWidth = (d < 8) ? 3 : 2;
+  uint8_t pad = 2 + MAPRANDOM(MAPSAMPLES - 2 - padWidth);
+  uint8_t startX = (pad + padWidth / 2 < MAPSAMPLES / 2) ? 110 : 28;
+  uint8_t start = (startX - MAPOFFSET) / 4;
+
+  // floor, bouncing off its limits, kept low below the start and next to the pad
+  uint8_t top = 20 + d;
+  uint8_t rough = 3 + d / 2;
+  int8_t h = 4 + MAPRANDOM(top - 4);
+  for (i = 0; i < MAPSAMPLES; i++)
+  {
+    h += MAPRANDOM(2 * rough + 1) - rough;
+    if (h > top)
+      h = 2 * top - h;
+    if (h < 1)
+      h = 2 - h;
+    map[0][i] = h;
+    if (i + 1 >= start && i <= start + 3 && h > 30)
+      map[0][i] = 30;
+    if (i + 1 >= pad && i <= pad + padWidth && h > top / 2)
+      map[0][i] = top / 2;
+    if (i >= pad && i < pad + padWidth)
+      map[0][i] = 0;
+  }
+
+  // ceiling, at least 18 pixels above the floor of the sample and its neighbours
+  for (i = 0; i < MAPSAMPLES; i++)
+  {
+    uint8_t c = 63;
+    uint8_t f = map[0][i];
+    if (i > 0 && map[0][i - 1] > f)
+      f = map[0][i - 1];
+    if (i + 1 < MAPSAMPLES && map[0][i + 1] > f)
+      f = map[0][i + 1];
+    if (d >= 3 && f + 18 < 63 && !(i + 1 >= start && i <= start + 3)
+        && !(i + 1 >= pad && i <= pad + padWidth) && MAPRANDOM(12) < d / 2)
+      c = f + 18 + MAPRANDOM(63 - f - 18);
+    map[1][i] = c;
+  }
+
+  // fuel for the way to the pad, less with every level
+  uint8_t padX = MAPOFFSET + pad * 4 + padWidth * 2;
+  uint8_t distance = (padX > startX) ? padX - startX : startX - padX;
+  uint8_t fuel = 60 + distance / 2 + ((d < 15) ? (15 - d) * 4 : 0);
+  param[0] = startX;
+  param[1] = 4;
+  param[2] = (fuel > 150) ? 150 : fuel;
+  param[3] = (d < 13) ? 120 + d * 10 : 250;
+  param[4] = (d < 20) ? 25 - d : 5;
+}
+
+// builds the column cache and the landing pad of the level from its samples,
+// and returns the level parameters in param
+void SETLANDSCAPE(uint8_t level, GAME *game, uint8_t *param)
+{
+  uint8_t map[2][MAPSAMPLES];
+  LOADLEVEL(level, map, param);
+  SetLandingMap(map[0], game);
+  const uint8_t *floor = map[0];
+  const uint8_t *ceiling = map[1];
+  uint8_t x;
+  for (x = 0; x < MAPWIDTH; x++)
   {
-    if ( (ind + 1) < 27)
+    uint8_t t =  x % 4;
+    uint8_t ind = x / 4;
+    uint8_t val = MAPHEIGHT - floor[ind];
+    uint8_t valT = MAPHEIGHT - ceiling[ind];
+    if (x > 0 && t != 0)
     {
-      if (val < height)
-      { uint8_t val2 = height - (GAMEMAP[level][ind + 1]);
-        val += ((val2 - val) / 4) * ( t);
+      if ( (ind + 1) < MAPSAMPLES)
+      {
+        if (val < MAPHEIGHT)
+        { uint8_t val2 = MAPHEIGHT - floor[ind + 1];
+          val += ((val2 - val) / 4) * ( t);
+        }
+        uint8_t valT2 = MAPHEIGHT - ceiling[ind + 1];
+        valT += ((valT2 - valT) / 4) * ( t);
       }
-      uint8_t valT2 = height - (GAMEMAP[level + 1][ind + 1]);
-      valT += ((valT2 - valT) / 4) * ( t);
     }
+    LandFloor[x] = val;
+    LandCeiling[x] = valT;
   }
+}
 
+uint8_t GETLANDSCAPE(uint8_t x, uint8_t y)
+{
+  uint8_t val = LandFloor[x];
+  uint8_t valT = LandCeiling[x];
+  uint8_t frame = 0x00;
   uint8_t b = val / 8;
   uint8_t bT = valT / 8;
+  if (y > b || y < bT )
+    return 0xFF;
   if (b == y)
   {
     // draw the landing-platform
-    if (val == height)
-      if (x % 2 == 0)
-        frame |= 0xB8;
-      else
-        frame |= 0x58;
+    if (val == MAPHEIGHT)
+      frame = (x % 2 == 0) ? 0xB8 : 0x58;
     else
       // draw pixel on the correct height
-      frame |= (0xFF << (val - (b * 8)) ) ;
+      frame = (0xFF << (val % 8));
   }
   if (bT == y)
-    frame |= (0xFF >>  (7 - (valT - (bT * 8))));
-  if (y > b || y < bT )
-    frame |= 0xFF;
-
+    frame |= (0xFF >>  (7 - (valT % 8)));
   return frame;
 }
 
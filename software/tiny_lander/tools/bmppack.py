@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Project:   bmppack - Bitmap Packer for SSD1306 Full-Screen Images
+# Version:   v1.0
+# Year:      2023
+# License:   MIT License
+# ===================================================================================
+#
+# Description:
+# ------------
+# Compresses 128x64 pixels OLED bitmaps (1024 bytes, 8 pages of 128 columns, as used
+# in the spritebank.h files) so that they can be stored in flash and decoded on the
+# fly by pack.c. Every packed page decodes to exactly 128 bytes, so the decoder can
+# stream one page at a time straight into the OLED page transfer.
+#
+# LZ format (for images that are streamed as a whole, e.g. title screens):
+# - 0x00..0x7F: literal, the next (n + 1) bytes are copied to the output
+# - 0x80..0xBF: run, the next byte is repeated (n - 0x80 + 3) times
+# - 0xC0..0xFF: copy, (n - 0xC0 + 3) bytes are copied from (next byte + 1) bytes
+#               back in the output (window of 128 bytes = one page)
+#
+# Indexed RLE format (for layer bitmaps that are looked up per byte, e.g. backgrounds):
+# - 8 x 16-bit little endian offsets of the packed pages
+# - run directory, per page 3 bytes: offsets of the packets at columns 32, 64 and 96
+#   from the start of the page
+# - the packed pages
+# - 0x00..0x7F: literal, the next (n + 1) bytes
+# - 0x80..0xFF: run, the next byte is repeated (n - 0x80 + 2) times
+# Packets never cross a page or a 32 columns segment boundary, so a decoder can
+# start at any segment and skip at most 32 columns of packets to reach any column.
+#
+# Operating Instructions:
+# -----------------------
+# - python bmppack.py [-h] [-a ARRAY] [-n NAME] [-i] [-u] INPUT
+#   -h, --help                show help message and exit
+#   -a ARRAY, --array ARRAY   read the bitmap from C array ARRAY in INPUT
+#                             (otherwise INPUT is a raw 1024 bytes binary file)
+#   -n NAME, --name NAME      name of the generated C array
+#   -i, --indexed             use indexed RLE format instead of LZ format
+#   -u, --unpack              unpack ARRAY again and print the raw bitmap
+#
+# - Example:
+#   python bmppack.py -a INTRO raw_intro.h > packed_intro.h
+#   python bmppack.py -i -a back raw_back.h > packed_back.h
+
+
+import re
+import sys
+import argparse
+
+PAGES       = 8           # number of pages (8 pixels high each)
+PAGE_SIZE   = 128         # bytes (columns) per page
+WINDOW      = 128         # back-reference window (bytes)
+MIN_MATCH   = 3           # shortest run/copy worth encoding
+MAX_MATCH   = 66          # longest run/copy (6 bit length + MIN_MATCH)
+MAX_LITERAL = 128         # longest literal (7 bit length + 1)
+MIN_RUN     = 2           # shortest run in indexed RLE format
+MAX_RUN     = 129         # longest run in indexed RLE format (7 bit length + MIN_RUN)
+SEGMENT     = 32          # columns per run directory entry in indexed RLE format
+
+# ===================================================================================
+# Main Function
+# ===================================================================================
+
+def _main():
+    parser = argparse.ArgumentParser(description='Bitmap packer for SSD1306 full-screen images')
+    parser.add_argument('-a', '--array', help='read bitmap from C array ARRAY in INPUT')
+    parser.add_argument('-n', '--name', help='name of the generated C array')
+    parser.add_argument('-i', '--indexed', action='store_true', help='use indexed RLE format')
+    parser.add_argument('-u', '--unpack', action='store_true', help='unpack ARRAY and print raw bitmap')
+    parser.add_argument('input', help='C source/header or raw binary file')
+    args = parser.parse_args(sys.argv[1:])
+
+    if args.array:
+        data = read_array(args.input, args.array)
+    else:
+        with open(args.input, 'rb') as f:
+            data = list(f.read())
+    name = args.name or args.array or 'BITMAP'
+
+    pack, unpack, fmt = pack_lz, unpack_lz, 'LZ'
+    if args.indexed:
+        pack, unpack, fmt = pack_rle, unpack_rle, 'indexed RLE'
+
+    if args.unpack:
+        print_array(name, unpack(data), 'raw bitmap')
+        return
+
+    if len(data) != PAGES * PAGE_SIZE:
+        raise SystemExit('ERROR: bitmap must be %d bytes, got %d' % (PAGES * PAGE_SIZE, len(data)))
+
+    packed = pack(data)
+    if unpack(packed) != data:
+        raise SystemExit('ERROR: verification failed')
+    print_array(name, packed, '%s packed, %d -> %d bytes' % (fmt, len(data), len(packed)))
+
+# ===================================================================================
+# LZ Packer
+# ===================================================================================
+
+def pack_lz(data):
+    out = []
+    for page in range(PAGES):
+        start = page * PAGE_SIZE
+        end   = start + PAGE_SIZE
+        lit   = []
+        i     = start
+        while i < end:
+            run = 1
+            while i + run < end and data[i + run] == data[i] and run < MAX_MATCH:
+                run += 1
+            best, dist = 0, 0
+            for d in range(1, min(WINDOW, i) + 1):
+                n = 0
+                while i + n < end and data[i + n - d] == data[i + n] and n < MAX_MATCH:
+                    n += 1
+                if n > best:
+                    best, dist = n, d
+            if best >= MIN_MATCH and best >= run:
+                _flush(out, lit)
+                out += [0xC0 + best - MIN_MATCH, dist - 1]
+                i += best
+            elif run >= MIN_MATCH:
+                _flush(out, lit)
+                out += [0x80 + run - MIN_MATCH, data[i]]
+                i += run
+            else:
+                lit.append(data[i])
+                i += 1
+        _flush(out, lit)
+    return out
+
+def _flush(out, lit):
+    while lit:
+        chunk = lit[:MAX_LITERAL]
+        out.append(len(chunk) - 1)
+        out += chunk
+        del lit[:MAX_LITERAL]
+
+def unpack_lz(packed):
+    out = []
+    i = 0
+    while i < len(packed):
+        hdr = packed[i]
+        i += 1
+        if hdr < 0x80:
+            out += packed[i:i + hdr + 1]
+            i += hdr + 1
+        elif hdr < 0xC0:
+            out += [packed[i]] * (hdr - 0x80 + MIN_MATCH)
+            i += 1
+        else:
+            dist = packed[i] + 1
+            i += 1
+            for _ in range(hdr - 0xC0 + MIN_MATCH):
+                out.append(out[-dist])
+    return out
+
+# ===================================================================================
+# Indexed RLE Packer
+# ===================================================================================
+
+def pack_rle(data):
+    pages = []
+    directory = []
+    for page in range(PAGES):
+        row = data[page * PAGE_SIZE:(page + 1) * PAGE_SIZE]
+        out = []
+        for seg in range(0, PAGE_SIZE, SEGMENT):
+            if seg:
+                directory.append(len(out))
+            lit = []
+            i   = seg
+            while i < seg + SEGMENT:
+                run = 1
+                while i + run < seg + SEGMENT and row[i + run] == row[i] and run < MAX_RUN:
+                    run += 1
+                if run >= MIN_RUN:
+                    _flush(out, lit)
+                    out += [0x80 + run - MIN_RUN, row[i]]
+                    i += run
+                else:
+                    lit.append(row[i])
+                    i += 1
+            _flush(out, lit)
+        pages.append(out)
+    index = []
+    offset = 2 * PAGES + len(directory)
+    for out in pages:
+        index += [offset & 0xFF, offset >> 8]
+        offset += len(out)
+    return index + directory + [b for out in pages for b in out]
+
+def unpack_rle(packed):
+    out = []
+    segs = PAGE_SIZE // SEGMENT - 1
+    for page in range(PAGES):
+        start = packed[2 * page] + (packed[2 * page + 1] << 8)
+        i     = start
+        end   = len(out) + PAGE_SIZE
+        while len(out) < end:
+            col = len(out) - (end - PAGE_SIZE)
+            if col and col % SEGMENT == 0:
+                if i - start != packed[2 * PAGES + page * segs + col // SEGMENT - 1]:
+                    raise SystemExit('ERROR: run directory does not match')
+            hdr = packed[i]
+            if hdr < 0x80:
+                out += packed[i + 1:i + hdr + 2]
+                i += hdr + 2
+            else:
+                out += [packed[i + 1]] * (hdr - 0x80 + MIN_RUN)
+                i += 2
+    return out
+
+# ===================================================================================
+# C Array Input/Output
+# ===================================================================================
+
+def read_array(filename, name):
+    with open(filename) as f:
+        src = f.read()
+    m = re.search(r'\b' + re.escape(name) + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', src, re.S)
+    if not m:
+        raise SystemExit('ERROR: array %s not found in %s' % (name, filename))
+    body = re.sub(r'//[^\n]*', '', m.group(1))
+    return [int(v, 0) & 0xFF for v in re.findall(r'0x[0-9a-fA-F]+|0b[01]+|\d+', body)]
+
+def print_array(name, data, comment):
+    print('// %s' % comment)
+    print('const uint8_t %s[] = {' % name)
+    for i in range(0, len(data), 16):
+        line = ', '.join('0x%02X' % b for b in data[i:i + 16])
+        print('  ' + line + (',' if i + 16 < len(data) else ''))
+    print('};')
+
+# ===================================================================================
+
+if __name__ == "__main__":
+    _main()
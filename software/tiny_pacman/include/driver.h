@@ -15,6 +15,9 @@ extern "C" {
 #include "system.h"
 #include "gpio.h"
 #include "oled_min.h"
+#include "pack.h"
+#include "kvstore.h"
+#include "suspend.h"
 
 // Pin assignments
 #define PIN_ACT     PA2   // pin connected to fire button
@@ -37,10 +40,16 @@ extern "C" {
 // Sound enable
 #define JOY_SOUND   1     // 0: no sound, 1: with sound
 
+// Keys of the driver settings in the flash store, games use JOY_KEY_GAME and up
+#define JOY_KEY_SOUND     0       // 0: sound off, else (or never set) on
+#define JOY_KEY_CAL       1       // ADC reading of joypad LEFT on this unit
+#define JOY_KEY_GAME      2       // first key free for the game
+
 // Game slow-down delay
 #define JOY_SLOWDOWN()    DLY_ms(20)
 
 // Init driver
+void JOY_settings(void);
 static inline void JOY_init(void) {
   PIN_input_AN(PIN_PAD);
   PIN_input_PU(PIN_ACT);
@@ -49,6 +58,7 @@ static inline void JOY_init(void) {
   OLED_init();
   ADC_init();
   ADC_input(PIN_PAD);
+  JOY_settings();
 }
 
 // OLED commands
@@ -57,6 +67,7 @@ static inline void JOY_init(void) {
 #define JOY_OLED_send(b)          I2C_write(b)
 #define JOY_OLED_send_command(c)  OLED_send_command(c)
 #define JOY_OLED_data_start(y)    {OLED_setpos(0,y);OLED_data_start();}
+#define JOY_OLED_draw_packed(p)   PACK_draw(p)
 
 // Buttons
 #define JOY_act_pressed()         (!PIN_read(PIN_ACT))
@@ -65,39 +76,48 @@ static inline void JOY_init(void) {
 #define JOY_pad_released()        (ADC_read() <= 10)
 #define JOY_all_released()        (JOY_act_released() && JOY_pad_released())
 
+// Read direction buttons, scaled by the calibration (8.8 fixed point)
+uint16_t JOY_scale = 256;
+static inline uint16_t JOY_read(void) {
+  uint16_t val = ADC_read();
+  if(JOY_scale != 256) val = ((uint32_t)val * JOY_scale) >> 8;
+  return val;
+}
+
 static inline uint8_t JOY_up_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_N  - JOY_DEV) && (val < JOY_N  + JOY_DEV))
          | ((val > JOY_NE - JOY_DEV) && (val < JOY_NE + JOY_DEV))
          | ((val > JOY_NW - JOY_DEV) && (val < JOY_NW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_down_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_S  - JOY_DEV) && (val < JOY_S  + JOY_DEV))
          | ((val > JOY_SE - JOY_DEV) && (val < JOY_SE + JOY_DEV))
          | ((val > JOY_SW - JOY_DEV) && (val < JOY_SW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_left_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_W  - JOY_DEV) && (val < JOY_W  + JOY_DEV))
          | ((val > JOY_NW - JOY_DEV) && (val < JOY_NW + JOY_DEV))
          | ((val > JOY_SW - JOY_DEV) && (val < JOY_SW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_right_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_E  - JOY_DEV) && (val < JOY_E  + JOY_DEV))
          | ((val > JOY_NE - JOY_DEV) && (val < JOY_NE + JOY_DEV))
          | ((val > JOY_SE - JOY_DEV) && (val < JOY_SE + JOY_DEV)) );
 }
 
 // Buzzer
+uint8_t JOY_mute;
 void JOY_sound(uint8_t freq, uint8_t dur) {
   while(dur--) {
     #if JOY_SOUND == 1
-    if(freq) PIN_low(PIN_BEEP);
+    if(freq && !JOY_mute) PIN_low(PIN_BEEP);
     #endif
     DLY_us(255 - freq);
     PIN_high(PIN_BEEP);
@@ -105,6 +125,26 @@ void JOY_sound(uint8_t freq, uint8_t dur) {
   }
 }
 
+// Load the settings from the flash store. Holding fire at power-up toggles the
+// sound, holding LEFT stores its reading as the calibration of this unit.
+void JOY_settings(void) {
+  uint16_t val;
+  KV_init();
+  if(JOY_act_pressed()) {
+    KV_set(JOY_KEY_SOUND, !KV_get(JOY_KEY_SOUND));
+    while(JOY_act_pressed());
+  }
+  val = ADC_read();
+  if((val > JOY_W - 2 * JOY_DEV) && (val < JOY_W + 2 * JOY_DEV)) {
+    KV_set(JOY_KEY_CAL, val);
+    while(JOY_pad_pressed());
+  }
+  KV_commit();
+  JOY_mute = !KV_get(JOY_KEY_SOUND);
+  val = KV_get(JOY_KEY_CAL);
+  if(val != KV_EMPTY) JOY_scale = ((uint32_t)JOY_W << 8) / val;
+}
+
 // Pseudo random number generator
 uint16_t rnval = 0xACE1;
 uint16_t JOY_random(void) {
@@ -112,6 +152,48 @@ uint16_t JOY_random(void) {
   return rnval;
 }
 
+// Power management
+#define JOY_IDLE_MS       60000   // suspend after 60 s without input
+#define JOY_VDD_MIN       2700    // suspend when supply voltage drops below (mV)
+
+// Read supply voltage (battery) in mV
+static inline uint16_t JOY_read_VDD(void) {
+  uint16_t vdd = ADC_read_VDD();
+  ADC_input(PIN_PAD);                             // back to the direction buttons
+  return vdd;
+}
+
+// Check if the game should be suspended, call once per game frame. Breaks of more
+// than a second (title screens, level intros) restart the idle time.
+uint32_t JOY_stamp, JOY_idle, JOY_vdd;
+uint8_t JOY_suspend_due(void) {
+  uint32_t now = STK->CNT;
+  uint32_t dt  = now - JOY_stamp;
+  JOY_stamp = now;
+  if(!JOY_all_released() || (dt > 1000 * DLY_MS_TIME)) JOY_idle = 0;
+  else JOY_idle += dt;
+  if(JOY_idle >= (uint32_t)JOY_IDLE_MS * DLY_MS_TIME) return 1;
+  JOY_vdd += dt;
+  if(JOY_vdd < 1000 * DLY_MS_TIME) return 0;
+  JOY_vdd = 0;
+  return(JOY_read_VDD() < JOY_VDD_MIN);
+}
+
+// Power down until the fire button is pressed, then restart (and resume)
+void JOY_sleep(void) {
+  JOY_OLED_send_command(OLED_DISPLAY_OFF);
+  PIN_high(PIN_BEEP);
+  while(JOY_act_pressed());                       // wait for fire button release
+  RCC->APB1PCENR |= RCC_PWREN;                    // enable power module
+  RCC->APB2PCENR |= RCC_AFIOEN;                   // enable AFIO
+  AFIO->EXTICR   &= ~((uint32_t)3 << 4);          // EXTI line 2 on port A (PIN_ACT)
+  EXTI->EVENR    |= ((uint32_t)1 << 2);           // enable line 2 event
+  EXTI->FTENR    |= ((uint32_t)1 << 2);           // on falling edge (button pressed)
+  do STDBY_WFE_now(); while(JOY_act_released());  // standby until fire is pressed
+  while(JOY_act_pressed());                       // don't pass the press to the game
+  RST_now();
+}
+
 // Delays
 #define JOY_DLY_ms    DLY_ms
 #define JOY_DLY_us    DLY_us
@@ -0,0 +1,59 @@
+// ===================================================================================
+// Basic Flash Functions for CH32V003                                         * v1.0 *
+// ===================================================================================
+
+#include "flash.h"
+
+// Wait for end of flash operation
+static void FLASH_wait(void) {
+  while(FLASH->STATR & FLASH_STATR_BSY);      // wait while busy
+  FLASH->STATR = FLASH_STATR_EOP;             // clear end of operation flag
+}
+
+// Unlock flash for erasing and programming
+void FLASH_unlock(void) {
+  FLASH->KEYR     = FLASH_KEY1;               // unlock flash
+  FLASH->KEYR     = FLASH_KEY2;
+  FLASH->MODEKEYR = FLASH_KEY1;               // unlock fast page erase
+  FLASH->MODEKEYR = FLASH_KEY2;
+}
+
+// Lock flash again
+void FLASH_lock(void) {
+  FLASH->CTLR |= FLASH_CTLR_LOCK | FLASH_CTLR_FLOCK;
+}
+
+// Erase 64-byte page at addr
+void FLASH_erase(uint32_t addr) {
+  FLASH->CTLR = FLASH_CTLR_PAGE_ER;           // fast page erase
+  FLASH->ADDR = addr;                         // set page address
+  FLASH->CTLR = FLASH_CTLR_PAGE_ER | FLASH_CTLR_STRT; // start erase
+  FLASH_wait();
+  FLASH->CTLR = 0;
+}
+
+// Program n bytes (n even) from p to erased flash at addr
+void FLASH_program(uint32_t addr, const uint8_t* p, uint8_t n) {
+  FLASH->CTLR = FLASH_CTLR_PG;                // standard programming
+  for(; n > 1; n -= 2, addr += 2, p += 2) {
+    *(volatile uint16_t*)addr = p[0] | ((uint16_t)p[1] << 8); // program half-word
+    FLASH_wait();
+  }
+  FLASH->CTLR = 0;
+}
+
+// Program 64-byte page at addr with 16 words from p
+void FLASH_page(uint32_t addr, const uint32_t* p) {
+  FLASH->CTLR = FLASH_CTLR_PAGE_PG;           // fast page programming
+  FLASH->CTLR = FLASH_CTLR_PAGE_PG | FLASH_CTLR_BUF_RST; // clear page buffer
+  FLASH->ADDR = addr;                         // set page address
+  FLASH_wait();
+  for(uint8_t i = 0; i < FLASH_PAGE_SIZE / 4; i++) {
+    ((volatile uint32_t*)addr)[i] = p[i];     // write word to page buffer
+    FLASH->CTLR = FLASH_CTLR_PAGE_PG | FLASH_CTLR_BUF_LOAD;
+    FLASH_wait();
+  }
+  FLASH->CTLR = FLASH_CTLR_PAGE_PG | FLASH_CTLR_STRT; // program page buffer
+  FLASH_wait();
+  FLASH->CTLR = 0;
+}
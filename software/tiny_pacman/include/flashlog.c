@@ -0,0 +1,85 @@
+// ===================================================================================
+// Record Log in Flash for CH32V003                                           * v1.0 *
+// ===================================================================================
+
+#include "flashlog.h"
+
+static uint8_t FLOG_newest = FLOG_NONE;       // slot of newest record
+static uint8_t FLOG_seq;                      // sequence number of newest record
+
+// Calculate CRC-8 (polynomial 0x07) of record, the top bit is cleared so a record
+// cut short before its last half-word (CRC still erased to 0xFF) is never valid
+static uint8_t FLOG_crc(const FLOG_record* r) {
+  const uint8_t* p = (const uint8_t*)r;
+  uint8_t crc = 0;
+  for(uint8_t n = sizeof(FLOG_record) - 1; n; n--) {
+    crc ^= *p++;
+    for(uint8_t i = 8; i; i--) crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+  }
+  return crc & 0x7F;
+}
+
+// Check if record is valid
+uint8_t FLOG_valid(const FLOG_record* r) {
+  return (r->magic == FLOG_MAGIC) && (r->crc == FLOG_crc(r));
+}
+
+// Check if slot is still erased
+static uint8_t FLOG_erased(const FLOG_record* r) {
+  const uint8_t* p = (const uint8_t*)r;
+  for(uint8_t n = sizeof(FLOG_record); n; n--) if(*p++ != 0xFF) return 0;
+  return 1;
+}
+
+// Scan the log for the newest record
+void FLOG_init(void) {
+  FLOG_newest = FLOG_NONE;
+  for(uint8_t n = 0; n < FLOG_SLOTS; n++) {
+    const FLOG_record* r = FLOG_slot(n);
+    if(!FLOG_valid(r)) continue;
+    if((FLOG_newest == FLOG_NONE) || ((int8_t)(r->seq - FLOG_seq) > 0)) {
+      FLOG_newest = n;
+      FLOG_seq    = r->seq;
+    }
+  }
+}
+
+// Copy data of the newest record, return 0 if there is none
+uint8_t FLOG_read(uint8_t* data) {
+  if(FLOG_newest == FLOG_NONE) return 0;
+  const FLOG_record* r = FLOG_slot(FLOG_newest);
+  for(uint8_t i = 0; i < FLOG_DATA; i++) data[i] = r->data[i];
+  return 1;
+}
+
+// Return slot of the newest record
+uint8_t FLOG_head(void) {
+  return FLOG_newest;
+}
+
+// Append record, return 0 if it could not be written
+uint8_t FLOG_write(const uint8_t* data) {
+  FLOG_record rec;
+  uint8_t n = FLOG_newest;
+  rec.magic = FLOG_MAGIC;
+  rec.seq   = FLOG_seq + 1;
+  for(uint8_t i = 0; i < FLOG_DATA; i++) rec.data[i] = data[i];
+  rec.crc   = FLOG_crc(&rec);
+
+  FLASH_unlock();
+  for(uint8_t tries = FLOG_SLOTS; tries; tries--) {
+    n = (n + 1) % FLOG_SLOTS;                 // next slot after newest record
+    uint32_t addr = FLOG_ADDR + n * sizeof(FLOG_record);
+    if(!(addr & (FLASH_PAGE_SIZE - 1))) FLASH_erase(addr); // entering a new page
+    else if(!FLOG_erased(FLOG_slot(n))) continue; // slot of a write cut short
+    FLASH_program(addr, (const uint8_t*)&rec, sizeof(rec));
+    if(FLOG_valid(FLOG_slot(n)) && (FLOG_slot(n)->seq == rec.seq)) {
+      FLOG_newest = n;
+      FLOG_seq    = rec.seq;
+      FLASH_lock();
+      return 1;
+    }                                         // slot was not erased, try next one
+  }
+  FLASH_lock();
+  return 0;
+}
@@ -0,0 +1,84 @@
+// ===================================================================================
+// Key-Value Store in Flash for CH32V003                                      * v1.0 *
+// ===================================================================================
+
+#include "kvstore.h"
+
+#define KV_NONE           0xFF                // pair has no record in the log
+#define KV_page(n)        ((n) / FLOG_PAGE_SLOTS) // log page of slot n
+
+static uint16_t KV_cache[KV_KEYS];            // cached values
+static uint8_t  KV_where[KV_PAIRS];           // slot of newest record of each pair
+static uint8_t  KV_dirty;                     // bit n: pair n changed since last commit
+
+// Append record with the cached values of pair
+static uint8_t KV_append(uint8_t pair) {
+  uint8_t data[FLOG_DATA];
+  uint16_t* val = &KV_cache[pair << 1];
+  data[0] = pair;
+  data[1] = val[0]; data[2] = val[0] >> 8;
+  data[3] = val[1]; data[4] = val[1] >> 8;
+  if(!FLOG_write(data)) return 0;
+  KV_where[pair] = FLOG_head();
+  KV_dirty &= ~(1 << pair);
+  return 1;
+}
+
+// Copy the live records of the page after the one the log writes to next
+static uint8_t KV_compact(void) {
+  uint8_t page = (KV_page((FLOG_head() + 1) % FLOG_SLOTS) + 1) % FLOG_PAGES;
+  for(uint8_t pair = 0; pair < KV_PAIRS; pair++) {
+    if((KV_where[pair] == KV_NONE) || (KV_page(KV_where[pair]) != page)) continue;
+    if(!KV_append(pair)) return 0;
+  }
+  return 1;
+}
+
+// Replay the log and cache the newest value of every key
+void KV_init(void) {
+  uint8_t head, seq;
+  KV_dirty = 0;
+  for(uint8_t i = 0; i < KV_KEYS; i++) KV_cache[i] = KV_EMPTY;
+  for(uint8_t i = 0; i < KV_PAIRS; i++) KV_where[i] = KV_NONE;
+  FLOG_init();
+  head = FLOG_head();
+  if(head == FLOG_NONE) return;
+  seq = FLOG_slot(head)->seq;
+  for(uint8_t n = 0; n < FLOG_SLOTS; n++) {
+    const FLOG_record* r = FLOG_slot(n);
+    uint8_t pair = r->data[0];
+    if(!FLOG_valid(r) || (pair >= KV_PAIRS)) continue;
+    if((KV_where[pair] != KV_NONE)
+      && ((uint8_t)(seq - r->seq) > (uint8_t)(seq - FLOG_slot(KV_where[pair])->seq)))
+      continue;                               // an even newer record was found before
+    KV_where[pair] = n;
+  }
+  for(uint8_t pair = 0; pair < KV_PAIRS; pair++) {
+    if(KV_where[pair] == KV_NONE) continue;
+    const uint8_t* d = FLOG_slot(KV_where[pair])->data;
+    KV_cache[(pair << 1)    ] = d[1] | (d[2] << 8);
+    KV_cache[(pair << 1) + 1] = d[3] | (d[4] << 8);
+  }
+}
+
+// Return value of key
+uint16_t KV_get(uint8_t key) {
+  return KV_cache[key];
+}
+
+// Set value of key in the cache
+void KV_set(uint8_t key, uint16_t val) {
+  if(KV_cache[key] == val) return;
+  KV_cache[key] = val;
+  KV_dirty |= 1 << (key >> 1);
+}
+
+// Append one record for every changed pair, compacting the log before each one
+uint8_t KV_commit(void) {
+  for(uint8_t pair = 0; pair < KV_PAIRS; pair++) {
+    if(!(KV_dirty & (1 << pair))) continue;
+    if(!KV_compact()) return 0;
+    if((KV_dirty & (1 << pair)) && !KV_append(pair)) return 0;
+  }
+  return 1;
+}
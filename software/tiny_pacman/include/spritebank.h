@@ -37,6 +37,13 @@ int8_t y;
 uint8_t switchanim;
 }PERSONAGE;
 
+typedef struct MAZENODE{
+uint8_t x;
+uint8_t y;
+uint8_t next[4];
+uint8_t len[4];
+}MAZENODE;
+
 const uint8_t  Music [] = {
 125,255,125,255,110,255,110,255,95,255,95,255,75,255,75,255,75,255,116,255,116,255,116,255,116,
 255,100,255,100,255,100,255,100,255,125,255,125,255,125,255,125,255,115,255,115,255,125,255,125,
@@ -65,205 +72,149 @@ const uint8_t caracters []  = {
 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00
 };
 
+// 'Maze' tile atlas, 4x8px tiles, generated with tools/tilemap.py
+const uint8_t  MazeTiles [] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x0C, 0xEC, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+0x2E, 0x2E, 0x20, 0x3E, 0x00, 0x00, 0x00, 0x3E, 0x20, 0x2E, 0x2E, 0x2C, 0x2C, 0xEC, 0x0C, 0xEC,
+0x2C, 0x2C, 0x2C, 0xEC, 0x0C, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+0x00, 0xE0, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x00, 0x00, 0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xE0,
+0x00, 0x00, 0x00, 0xE0, 0x20, 0xA0, 0xA0, 0xA0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF,
+0x00, 0xE0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xBF, 0xBF, 0xBF,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x80, 0x80,
+0x80, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0x80, 0x80, 0xFE, 0xFE, 0x00, 0xFF,
+0x00, 0x00, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F,
+0x08, 0x0F, 0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+0x02, 0x02, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x10, 0xF0, 0x00, 0x00,
+0x00, 0xFF, 0x00, 0xFE, 0x02, 0x03, 0x00, 0x00, 0x02, 0x02, 0x02, 0xFE, 0x00, 0xFE, 0x02, 0xFA,
+0xFA, 0xFA, 0xFA, 0xFA, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x02, 0x03,
+0x00, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x0F, 0x08, 0x0B,
+0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x0E, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0E,
+0x08, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x0F, 0x08, 0x0F, 0x00, 0x00, 0x3F, 0x7F,
+0x60, 0x6F, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0xE8, 0xE8, 0x08, 0xF8, 0x00, 0x00, 0x00, 0xF8,
+0x08, 0xE8, 0xE8, 0x68, 0x68, 0x6F, 0x60, 0x6F, 0x68, 0x68, 0x68, 0x6F, 0x60, 0x7F, 0x3F, 0x00,
+0x00, 0x00, 0xF0, 0xF8, 0x1C, 0xCC, 0x2C, 0x2C, 0x2E, 0x2E, 0x20, 0x1E, 0x00, 0x00, 0x00, 0x1E,
+0x2C, 0x2C, 0x2C, 0xCC, 0x1C, 0xF8, 0xF0, 0x00, 0x00, 0xC0, 0x20, 0xA0, 0x00, 0x00, 0x40, 0xA0,
+0xA0, 0xA0, 0xA0, 0x40, 0x00, 0x00, 0x00, 0xC0, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xBF,
+0x00, 0xC0, 0x20, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00,
+0x00, 0x7F, 0x80, 0x7F, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xA8, 0x07, 0x00, 0x00,
+0x02, 0x02, 0x01, 0x00, 0x10, 0xE0, 0x00, 0x00, 0x2A, 0xC0, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+0x00, 0xFC, 0x02, 0xFA, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
+0x00, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x07, 0x08, 0x0B,
+0x00, 0x00, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x08, 0x07, 0x00, 0x00, 0x00, 0x07, 0x08, 0x07,
+0x00, 0x00, 0x1F, 0x3F, 0x70, 0x67, 0x68, 0x68, 0xE8, 0xE8, 0x08, 0xF0, 0x68, 0x68, 0x68, 0x67,
+0x70, 0x3F, 0x1F, 0x00
+};
+
+// 'Maze' tile rows, OR of the columns of each tile, generated with tools/tilemap.py -r
+const uint8_t  MazeRows [] = {
+0x00, 0xFC, 0xEC, 0x2C, 0x3E, 0x3E, 0x2E, 0xEC, 0xEC, 0xFC, 0xFF, 0xFF, 0xE0, 0xA0, 0xE0, 0xE0,
+0xE0, 0xA0, 0xE0, 0xFF, 0xE0, 0xFF, 0xFF, 0xBF, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+0x1F, 0x1F, 0xFF, 0x0F, 0x0F, 0xFF, 0xFE, 0x02, 0x03, 0xFF, 0xF0, 0xF0, 0xFF, 0x03, 0xFE, 0xFE,
+0xFA, 0x03, 0x03, 0x03, 0xFE, 0xFE, 0xFE, 0x0F, 0x0B, 0x0E, 0x0A, 0x0E, 0x0B, 0x0B, 0x0F, 0x7F,
+0x6F, 0x68, 0xF8, 0xF8, 0xE8, 0x6F, 0x6F, 0x7F, 0xF8, 0xFC, 0x3E, 0x1E, 0xEC, 0xFC, 0xE0, 0xE0,
+0xE0, 0xC0, 0xE0, 0xFF, 0xE0, 0x80, 0x7F, 0xFF, 0xFF, 0x1F, 0x07, 0xAF, 0x03, 0xF0, 0xEA, 0x03,
+0xFE, 0x03, 0x01, 0x03, 0xFC, 0xFE, 0xFE, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x3F, 0x7F, 0xF8, 0x6F,
+0x7F
+};
+
+// 'back' tile map (walls for collision), 32x8 tiles
 const uint8_t  back [] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x0C, 0xEC, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2E, 0x2E, 0x20, 0x3E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x20, 0x2E, 0x2E, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xEC, 0x0C, 0xEC,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xEC, 0x0C, 0xFC, 0xF8, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xE0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xE0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
-0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xE0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x80, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x0F, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0x02, 0x02,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xF0, 0x10, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xE0, 0x20, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x02, 0xFE, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFE, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x0F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x08, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-0x0A, 0x0A, 0x0A, 0x0B, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x02, 0xFA,
-0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x0F, 0x08, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x6F, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0xE8, 0xE8, 0x08, 0xF8,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x08, 0xE8, 0xE8, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6F, 0x60, 0x6F,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6F, 0x60, 0x7F, 0x3F, 0x00
+0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04,
+0x00, 0x05, 0x06, 0x03, 0x03, 0x03, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x09,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x0C, 0x0D, 0x8C, 0x00, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0F,
+0x00, 0x10, 0x11, 0x0D, 0x0D, 0x12, 0x00, 0x13, 0x0D, 0x0D, 0x12, 0x00, 0x14, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x13, 0x17, 0x93, 0x00, 0x18, 0x19, 0x00, 0x1A, 0x98, 0x00, 0x1B,
+0x00, 0x15, 0x0B, 0x00, 0x15, 0x0B, 0x00, 0x1B, 0x00, 0x15, 0x1C, 0x00, 0x1D, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x1E, 0x19, 0x19, 0x19, 0x9B, 0x00, 0x8B, 0x1F, 0x00, 0x20, 0x21, 0x00, 0x22,
+0x00, 0x15, 0x0B, 0x00, 0x23, 0x24, 0x00, 0x22, 0x19, 0x19, 0x98, 0x00, 0x1B, 0x19, 0x25, 0x16,
+0x00, 0x00, 0x0A, 0x26, 0x27, 0x27, 0x27, 0x28, 0x00, 0x8B, 0x29, 0x00, 0x2A, 0x2B, 0x00, 0x22,
+0x00, 0x15, 0x0B, 0x00, 0x10, 0x12, 0x00, 0x2C, 0x27, 0x27, 0x2D, 0x00, 0xA8, 0x27, 0x2E, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x2F, 0x30, 0xAF, 0x00, 0xAD, 0x31, 0x00, 0x32, 0x2D, 0x00, 0x33,
+0x00, 0x15, 0x0B, 0x00, 0x15, 0x0B, 0x00, 0x33, 0x00, 0x34, 0x35, 0x00, 0x36, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x37, 0x38, 0xB7, 0x00, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3B,
+0x00, 0x23, 0x3C, 0x3A, 0x3D, 0x24, 0x00, 0x2F, 0x3A, 0x3D, 0x24, 0x00, 0x3E, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x3F, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42,
+0x00, 0x43, 0x44, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x46, 0x47
+};
+
+// 'dots' as table of (column, byte) pairs in screen scan order, 64 dots
+const uint8_t  DotsPos [] = {
+0x11, 0x06, 0x12, 0x06, 0x1A, 0x02, 0x23, 0x02, 0x2C, 0x02, 0x35, 0x02, 0x3E, 0x02, 0x47, 0x02,
+0x50, 0x02, 0x59, 0x02, 0x63, 0x02, 0x6D, 0x02, 0x77, 0x06, 0x78, 0x06, 0x11, 0x04, 0x23, 0x04,
+0x2F, 0x08, 0x39, 0x08, 0x43, 0x08, 0x59, 0x08, 0x63, 0x08, 0x6D, 0x04, 0x77, 0x04, 0x11, 0x08,
+0x1A, 0x08, 0x23, 0x08, 0x2F, 0x08, 0x39, 0x08, 0x59, 0x08, 0x63, 0x08, 0x6D, 0x08, 0x77, 0x08,
+0x11, 0x20, 0x1A, 0x20, 0x23, 0x20, 0x2F, 0x20, 0x39, 0x20, 0x59, 0x20, 0x63, 0x20, 0x6D, 0x20,
+0x77, 0x20, 0x11, 0x40, 0x23, 0x40, 0x2F, 0x20, 0x39, 0x20, 0x43, 0x20, 0x59, 0x20, 0x63, 0x20,
+0x6D, 0x40, 0x77, 0x40, 0x11, 0xC0, 0x12, 0xC0, 0x1A, 0x80, 0x23, 0x80, 0x2C, 0x80, 0x35, 0x80,
+0x3E, 0x80, 0x47, 0x80, 0x50, 0x80, 0x59, 0x80, 0x63, 0x80, 0x6D, 0x80, 0x77, 0xC0, 0x78, 0xC0
+};
+
+// index of first dot on each page (page 8 = end of table)
+const uint8_t  DotsPage [] = {
+0, 0, 14, 23, 32, 41, 50, 64, 64
 };
 
-const uint8_t  dots [] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// maze junction graph, neighbour nodes and distances are left, right, up, down
+#define MAZE_NODES 38
+const MAZENODE  MazeNodes [] = {
+{14,14,{255,1,255,13},{0,17,0,18}},
+{31,14,{0,2,255,7},{17,33,0,10}},
+{64,14,{1,3,33,10},{33,22,34,10}},
+{86,14,{2,255,255,11},{22,0,0,10}},
+{96,14,{255,5,255,255},{0,10,0,0}},
+{106,14,{4,6,255,16},{10,10,0,18}},
+{116,14,{5,255,255,17},{10,0,0,18}},
+{31,24,{255,8,1,14},{0,13,10,8}},
+{44,24,{7,9,255,18},{13,10,0,13}},
+{54,24,{8,10,255,19},{10,10,0,13}},
+{64,24,{9,255,2,28},{10,0,10,26}},
+{86,24,{255,12,3,29},{0,10,10,26}},
+{96,24,{11,255,255,15},{10,0,0,8}},
+{14,32,{255,14,0,255},{0,17,18,0}},
+{31,32,{13,255,7,21},{17,0,8,10}},
+{96,32,{255,16,12,255},{0,10,8,0}},
+{106,32,{15,17,5,23},{10,10,18,10}},
+{116,32,{16,255,6,255},{10,0,18,0}},
+{44,37,{255,19,8,26},{0,10,13,13}},
+{54,37,{18,255,9,27},{10,0,13,13}},
+{14,42,{255,21,255,31},{0,17,0,18}},
+{31,42,{20,255,14,25},{17,0,10,8}},
+{96,42,{255,23,255,30},{0,10,0,8}},
+{106,42,{22,24,16,36},{10,10,10,18}},
+{116,42,{23,255,255,37},{10,0,0,18}},
+{31,50,{255,26,21,32},{0,13,8,10}},
+{44,50,{25,27,18,255},{13,10,13,0}},
+{54,50,{26,28,19,255},{10,10,13,0}},
+{64,50,{27,255,10,33},{10,0,26,10}},
+{86,50,{255,30,11,34},{0,10,26,10}},
+{96,50,{29,255,22,255},{10,0,8,0}},
+{14,60,{255,32,20,255},{0,17,18,0}},
+{31,60,{31,33,25,255},{17,33,10,0}},
+{64,60,{32,34,28,2},{33,22,10,34}},
+{86,60,{33,255,29,255},{22,0,10,0}},
+{96,60,{255,36,255,255},{0,10,0,0}},
+{106,60,{35,37,23,255},{10,10,18,0}},
+{116,60,{36,255,24,255},{10,0,18,0}}
 };
 
+// 'BackBlitz' tile map (maze as drawn), 32x8 tiles
 const uint8_t  BackBlitz [] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0x1C, 0xCC, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2E, 0x2E, 0x20, 0x1E,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x2E, 0x2E, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xEC, 0x0C, 0xEC,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
-0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0xCC, 0x1C, 0xF8, 0xF0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xC0, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x40,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
-0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xBF,
-0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xC0, 0x20, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x80, 0x7F, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x7F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x07, 0xA8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0x02, 0x02,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xE0, 0x10, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xC0, 0x2A, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE,
-0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0xFA, 0x02, 0xFC, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0xFC, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x07, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x04,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
-0x0A, 0x0A, 0x0A, 0x0B, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x02, 0xFA,
-0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x07, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x67, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0xE8, 0xE8, 0x08, 0xF0,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x08, 0xE8, 0xE8, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6F, 0x60, 0x6F,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
-0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x70, 0x3F, 0x1F, 0x00
+0x00, 0x00, 0x48, 0x49, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4A,
+0x00, 0x4B, 0x06, 0x03, 0x03, 0x03, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x4C, 0x4D,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x4E, 0x0D, 0xCE, 0x00, 0x4F, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x50,
+0x00, 0x51, 0x11, 0x0D, 0x0D, 0x52, 0x00, 0x53, 0x0D, 0x0D, 0x52, 0x00, 0x54, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x53, 0x17, 0xD3, 0x00, 0x1A, 0x9B, 0x00, 0x00, 0x9A, 0x00, 0x55,
+0x00, 0x15, 0x0B, 0x00, 0x15, 0x0B, 0x00, 0x55, 0x00, 0x56, 0x57, 0x00, 0x58, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x1E, 0x19, 0x19, 0x19, 0x98, 0x00, 0x8B, 0x1F, 0x00, 0x23, 0x59, 0x00, 0x22,
+0x00, 0x15, 0x0B, 0x00, 0x5A, 0x5B, 0x00, 0x22, 0x19, 0x19, 0x9A, 0x00, 0x18, 0x19, 0x25, 0x16,
+0x00, 0x00, 0x0A, 0x26, 0x27, 0x27, 0x27, 0x5C, 0x00, 0x8B, 0x29, 0x00, 0x10, 0x5D, 0x00, 0x22,
+0x00, 0x15, 0x0B, 0x00, 0x51, 0x5E, 0x00, 0x2C, 0x27, 0x27, 0x5F, 0x00, 0xDC, 0x27, 0x2E, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x60, 0x30, 0xE0, 0x00, 0xDF, 0x61, 0x00, 0x62, 0x5F, 0x00, 0x63,
+0x00, 0x15, 0x0B, 0x00, 0x15, 0x0B, 0x00, 0x63, 0x00, 0x64, 0x65, 0x00, 0x66, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x0A, 0x0B, 0x00, 0x67, 0x38, 0xE7, 0x00, 0x68, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x69,
+0x00, 0x5A, 0x3C, 0x3A, 0x3D, 0x6A, 0x00, 0x60, 0x3A, 0x3D, 0x6A, 0x00, 0x6B, 0x00, 0x15, 0x16,
+0x00, 0x00, 0x6C, 0x6D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x6E,
+0x00, 0x2A, 0x44, 0x41, 0x41, 0x41, 0x41, 0x45, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x6F, 0x70
 };
 
 #ifdef __cplusplus
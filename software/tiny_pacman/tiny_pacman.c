@@ -39,10 +39,17 @@ uint8_t INGAME;
 uint8_t Gobeactive;
 uint8_t TimerGobeactive;
 uint8_t add;
-uint8_t dotsMem[9];
-int8_t dotscount;
+uint32_t dotsMem[2];
+uint8_t DotsLeft;
+uint8_t DotsNext;
 uint8_t Frame;
+uint8_t MazeDist[MAZE_NODES];
+uint8_t MazeTarget;
+uint8_t PacNode;
+uint8_t PacDir;
+uint8_t GhostNode[5];
 enum {PACMAN=0,FANTOME=1,FRUIT=2};
+#define MAZE_NONE 0xFF
 
 // ===================================================================================
 // Function Prototypes
@@ -55,16 +62,30 @@ uint8_t CheckCollisionWithBack(uint8_t SpriteCheck,uint8_t HorVcheck,PERSONAGE *
 uint8_t RecupeBacktoCompV(uint8_t SpriteCheck,PERSONAGE *Sprite);
 uint8_t Trim(uint8_t Y1orY2,uint8_t TrimValue,uint8_t Decalage);
 uint8_t RecupeBacktoCompH(uint8_t SpriteCheck,PERSONAGE *Sprite);
+uint8_t ScanWallH(uint16_t pos,uint8_t RECUPE);
 void Tiny_Flip(uint8_t render0_picture1,PERSONAGE *Sprite);
 uint8_t FruitWrite(uint8_t x,uint8_t y);
 uint8_t LiveWrite(uint8_t x,uint8_t y);
-uint8_t DotsWrite(uint8_t x,uint8_t y,PERSONAGE *Sprite);
-uint8_t checkDotPresent(uint8_t  DotsNumber);
+uint8_t DotsWrite(uint8_t x,uint8_t y);
+void DotsReset(void);
+void DotsEat(PERSONAGE *Sprite);
+uint32_t checkDotPresent(uint8_t  DotsNumber);
+uint32_t checkDotPellet(uint8_t  DotsNumber);
 void DotsDestroy(uint8_t DotsNumber);
 uint8_t SplitSpriteDecalageY(uint8_t decalage,uint8_t Input,uint8_t UPorDOWN);
 uint8_t SpriteWrite(uint8_t x,uint8_t y,PERSONAGE  *Sprite);
 uint8_t return_if_sprite_present(uint8_t x,PERSONAGE  *Sprite,uint8_t SpriteNumber);
 uint8_t background(uint8_t x,uint8_t y);
+uint8_t BackRead(uint16_t pos);
+uint8_t MazeByte(const uint8_t *Map,uint8_t x,uint8_t y);
+void MazeReset(PERSONAGE *Sprite);
+uint8_t MazeRow(PERSONAGE *Sprite,uint8_t t);
+uint8_t MazeOffset(uint8_t Node,uint8_t Dir,uint8_t x,uint8_t Row);
+void MazeUpdateTarget(PERSONAGE *Sprite);
+void MazeFlow(void);
+void GhostLeave(uint8_t t,PERSONAGE *Sprite);
+void GhostSteer(uint8_t t,PERSONAGE *Sprite);
+uint8_t SuspendGame(uint8_t mode,PERSONAGE *Sprite);
 
 // ===================================================================================
 // Main Function
@@ -77,6 +98,7 @@ int main(void) {
   while(1) {
     uint8_t t;
     PERSONAGE Sprite[5];
+    if(SuspendGame(SUSPEND_LOAD, &Sprite[0])) goto RESUME;
   NEWGAME:
     ResetVar();
     LIVE=3;
@@ -96,7 +118,7 @@ int main(void) {
     }
   New:
     GobbingEND = (LEVELSPEED / 2);
-    for(t=0; t<9; t++) dotsMem[t]=0xff;
+    DotsReset();
   RESTARTLEVEL:
     Gobeactive = 0;
     uint8_t* ptr = (uint8_t*)Sprite;
@@ -124,6 +146,8 @@ int main(void) {
     Sprite[4].x=76;
     Sprite[4].y=5;
     Sprite[4].guber=0;
+    MazeReset(&Sprite[0]);
+  RESUME:
     while(1) {
       //joystick
       if(JOY_act_pressed()) StartGame(&Sprite[0]);
@@ -152,6 +176,7 @@ int main(void) {
         else goto NEWGAME;
       }
       if(Frame % 2 == 0) {
+        if(INGAME) DotsEat(&Sprite[0]);
         Tiny_Flip(0, &Sprite[0]);
         if(INGAME == 1) {
           for(uint8_t t=0; t<=139; t=t+2) {
@@ -160,19 +185,18 @@ int main(void) {
           INGAME = 2;
         }
       }
-      else {
-        for(t=0; t<63; t++) {
-          if(checkDotPresent(t)) break;
-          else if(t == 62) {
-            for(uint8_t r=0; r<60; r++) {
-              JOY_sound(2 + r, 10); JOY_sound(255 - r, 20);
-            }
-            JOY_DLY_ms(1000);
-            goto NEWLEVEL;
-          }
+      else if(DotsLeft == 0) {
+        for(uint8_t r=0; r<60; r++) {
+          JOY_sound(2 + r, 10); JOY_sound(255 - r, 20);
         }
+        JOY_DLY_ms(1000);
+        goto NEWLEVEL;
       }
       if((Gobeactive) && (Frame % 2 == 0)) JOY_sound((255 - TimerGobeactive), 1);
+      if(JOY_suspend_due()) {
+        SuspendGame(SUSPEND_SAVE, &Sprite[0]);
+        JOY_sleep();
+      }
       JOY_SLOWDOWN();
     }
   }
@@ -181,6 +205,28 @@ int main(void) {
 // ===================================================================================
 // Functions
 // ===================================================================================
+uint8_t SuspendGame(uint8_t mode,PERSONAGE *Sprite){
+if (!SUSPEND_begin(mode,'P')) return 0;
+SUSPEND_xfer(Sprite,5*sizeof(PERSONAGE));
+SUSPEND_var(LEVELSPEED);
+SUSPEND_var(GobbingEND);
+SUSPEND_var(LIVE);
+SUSPEND_var(INGAME);
+SUSPEND_var(Gobeactive);
+SUSPEND_var(TimerGobeactive);
+SUSPEND_var(add);
+SUSPEND_var(dotsMem);
+SUSPEND_var(DotsLeft);
+SUSPEND_var(DotsNext);
+SUSPEND_var(Frame);
+SUSPEND_var(MazeDist);
+SUSPEND_var(MazeTarget);
+SUSPEND_var(PacNode);
+SUSPEND_var(PacDir);
+SUSPEND_var(GhostNode);
+return SUSPEND_end();
+}
+
 void ResetVar(void){
 LEVELSPEED=200;
 GobbingEND=0;
@@ -189,9 +235,7 @@ Gobeactive=0;
 TimerGobeactive=0;
 add=0;
 INGAME=0;
-for(uint8_t t=0;t<9;t++){
-dotsMem[t]=0xff;}
-dotscount=0;
+DotsReset();
 Frame=0;}
 
 void StartGame(PERSONAGE *Sprite){
@@ -204,6 +248,7 @@ Sprite[3].x=77;
 Sprite[3].y=3;
 Sprite[4].x=76;
 Sprite[4].y=4;
+MazeReset(Sprite);
 INGAME=1;}}
 
 uint8_t CollisionPac2Caracter(PERSONAGE *Sprite){
@@ -220,7 +265,9 @@ if (Gobeactive) {if (Sprite[t].guber!=1) {JOY_sound(20,100);JOY_sound(2,100);}Sp
 
 void RefreshCaracter(PERSONAGE *Sprite){
 uint8_t memx,memy,memdecalagey;
+MazeUpdateTarget(Sprite);
 for (uint8_t t=0;t<=4;t++){
+if (t!=0) {GhostSteer(t,Sprite);}
 memx=Sprite[t].x;
 memy=Sprite[t].y;
 memdecalagey=Sprite[t].Decalagey;
@@ -232,7 +279,7 @@ if (t==0) {
 if ((Sprite[0].y==3)&&(Sprite[0].x==86)){}else{Sprite[t].x--;}
 }else{Sprite[t].x--;}
 }}}
-if (CheckCollisionWithBack(t,1,Sprite)) {
+if ((GhostNode[t]==MAZE_NONE)&&(CheckCollisionWithBack(t,1,Sprite))) {
 if (t!=0) {Sprite[t].DirectionV=JOY_random()%2;}else{ Sprite[t].DirectionV=2;}
 Sprite[t].x=memx;
 }
@@ -240,7 +287,7 @@ if ((Frame%2==0)||(t==0)||(LEVELSPEED<=160)) {
 if (Sprite[t].DirectionH==1) {if (Sprite[t].Decalagey<7) {Sprite[t].Decalagey++;}else{Sprite[t].Decalagey=0;Sprite[t].y++;if (Sprite[t].y==9) {Sprite[t].y=-1;}}}
 if (Sprite[t].DirectionH==0) {if (Sprite[t].Decalagey>0) {Sprite[t].Decalagey--;}else{Sprite[t].Decalagey=7;Sprite[t].y--;if (Sprite[t].y==-2) {Sprite[t].y=8;}}}
 }
-if (CheckCollisionWithBack(t,0,Sprite)) {
+if ((GhostNode[t]==MAZE_NONE)&&(CheckCollisionWithBack(t,0,Sprite))) {
 if (t!=0) {Sprite[t].DirectionH=JOY_random()%2;}else{Sprite[t].DirectionH=2;}
 Sprite[t].y=memy;
 Sprite[t].Decalagey=memdecalagey;
@@ -284,11 +331,11 @@ uint8_t Y2=Y1;
 #define MAXV (Sprite[SpriteCheck].x+SpriteWide)
 #define MINV (Sprite[SpriteCheck].x)
 if (Sprite[SpriteCheck].DirectionV==1) {
-Y1=(back[((Sprite[SpriteCheck].y)*128)+(MAXV)]);
-Y2=(back[((Sprite[SpriteCheck].y+1)*128)+(MAXV)]);
+Y1=BackRead(((Sprite[SpriteCheck].y)*128)+(MAXV));
+Y2=BackRead(((Sprite[SpriteCheck].y+1)*128)+(MAXV));
 }else if (Sprite[SpriteCheck].DirectionV==0) {
-Y1=(back[((Sprite[SpriteCheck].y)*128)+(MINV)]);
-Y2=(back[((Sprite[SpriteCheck].y+1)*128)+(MINV)]);
+Y1=BackRead(((Sprite[SpriteCheck].y)*128)+(MINV));
+Y2=BackRead(((Sprite[SpriteCheck].y+1)*128)+(MINV));
 }else{Y1=0;Y2=0;}
 //decortique
 Y1=Trim(0,Y1,Sprite[SpriteCheck].Decalagey);
@@ -314,38 +361,43 @@ return 0b01111111>>(8-Decalage);
 }}
 
 uint8_t RecupeBacktoCompH(uint8_t SpriteCheck,PERSONAGE *Sprite){
-uint8_t TempPGMByte;
 if (Sprite[SpriteCheck].DirectionH==0) {
 uint8_t RECUPE=(ScanHRecupe(0,Sprite[SpriteCheck].Decalagey));
-for(uint8_t t=0;t<=6;t++){
-if ((((Sprite[SpriteCheck].y)*128)+(Sprite[SpriteCheck].x+t)>1023)||(((Sprite[SpriteCheck].y)*128)+(Sprite[SpriteCheck].x+t)<0)) {TempPGMByte=0x00;}else{
- TempPGMByte=((back[((Sprite[SpriteCheck].y)*128)+(Sprite[SpriteCheck].x+t)])); 
-}
-#define CHECKCOLLISION ((RECUPE)&(TempPGMByte))
-if  (CHECKCOLLISION!=0) {return 1;}
-}}else if (Sprite[SpriteCheck].DirectionH==1) {
+return ScanWallH(((Sprite[SpriteCheck].y)*128)+(Sprite[SpriteCheck].x),RECUPE);
+}else if (Sprite[SpriteCheck].DirectionH==1) {
 uint8_t tadd=0;
 if (Sprite[SpriteCheck].Decalagey>2) { tadd=1;}else{tadd=0;}
 uint8_t RECUPE=(ScanHRecupe(tadd,Sprite[SpriteCheck].Decalagey));
-for(uint8_t t=0;t<=6;t++){
-if (((((Sprite[SpriteCheck].y+tadd)*128)+(Sprite[SpriteCheck].x+t))>1023)||((((Sprite[SpriteCheck].y+tadd)*128)+(Sprite[SpriteCheck].x+t))<0)) {TempPGMByte=0x00;}else{
-TempPGMByte=(back[((Sprite[SpriteCheck].y+tadd)*128)+(Sprite[SpriteCheck].x+t)]);
+return ScanWallH(((Sprite[SpriteCheck].y+tadd)*128)+(Sprite[SpriteCheck].x),RECUPE);
+}return 0;}
+
+// scan the 7 wall bytes starting at pos tile by tile: the rows of a tile decide
+// it as a whole, missing RECUPE or lying fully inside the scan, only a tile at
+// either end of the scan with rows in RECUPE is checked byte by byte
+uint8_t ScanWallH(uint16_t pos,uint8_t RECUPE){
+uint16_t end=pos+6;
+if (end>1023) {end=1023;}
+while(pos<=end){
+uint16_t last=pos|3;
+if (last>end) {last=end;}
+if (RECUPE&MazeRows[back[pos>>2]&0x7F]) {
+if (((pos&3)==0)&&((last&3)==3)) {return 1;}
+for(;pos<=last;pos++){if ((RECUPE&BackRead(pos))!=0) {return 1;}}
 }
-#define CHECKCOLLISION2 ((RECUPE)&(TempPGMByte))
-if  (CHECKCOLLISION2!=0) {return 1;}
-}}return 0;}
+pos=last+1;
+}return 0;}
 
 void Tiny_Flip(uint8_t render0_picture1,PERSONAGE *Sprite){
 uint8_t y,x; 
-dotscount=-1;
+DotsNext=0;
 for (y = 0; y < 8; y++){ 
 JOY_OLED_data_start(y);
 for (x = 0; x < 128; x++){
 if (render0_picture1==0) {
-if (INGAME) {JOY_OLED_send(background(x,y)|SpriteWrite(x,y,Sprite)|DotsWrite(x,y,Sprite)|LiveWrite(x,y)|FruitWrite(x,y));}else{
+if (INGAME) {JOY_OLED_send(background(x,y)|SpriteWrite(x,y,Sprite)|DotsWrite(x,y)|LiveWrite(x,y)|FruitWrite(x,y));}else{
 JOY_OLED_send(0xff-(background(x,y)|SpriteWrite(x,y,Sprite)));
 }}else if (render0_picture1==1){
-JOY_OLED_send((back[x+(y*128)]));}}
+JOY_OLED_send(BackRead(x+(y*128)));}}
 JOY_OLED_end();
 }}
 
@@ -361,56 +413,46 @@ uint8_t LiveWrite(uint8_t x,uint8_t y){
 if (y<LIVE) {if (x<=7) {return (caracters[x+(1*8)]);}else{return 0;}
 }return 0x00;}
 
-uint8_t DotsWrite(uint8_t x,uint8_t y,PERSONAGE *Sprite){
-uint8_t Menreturn=0;
-uint8_t mem1=(dots[x+(128*y)]);
-if (mem1!=0b00000000) {
-dotscount++;
- switch(dotscount){
-  case 0:  
-  case 1: 
-  case 12: 
-  case 13: 
-  case 50:
-  case 51:
-  case 62:
-  case 63:Menreturn=1;break;
-  default:Menreturn=0;break;
+// dots are drawn in screen scan order, so the next dot to draw is DotsNext
+uint8_t DotsWrite(uint8_t x,uint8_t y){
+if ((DotsNext>=DotsPage[y+1])||(DotsPos[DotsNext<<1]!=x)) {return 0;}
+uint8_t i=DotsNext++;
+if (checkDotPresent(i)==0) {return 0;}
+if ((checkDotPellet(i))&&(((Frame>=6)&&(Frame<=12))||((Frame>=18)&&(Frame<=24)))) {return 0;}
+return DotsPos[(i<<1)+1];
 }
-if (checkDotPresent(dotscount)==0b00000000) {mem1=0x00;}else{
-if ((Sprite[0].type==PACMAN)&&((Sprite[0].x<x)&&(Sprite[0].x>x-6))&&(((Sprite[0].y==y)&&(Sprite[0].Decalagey<6))||((Sprite[0].y==y-1)&&(Sprite[0].Decalagey>5)))) {DotsDestroy(dotscount);if (Menreturn==1) {TimerGobeactive=LEVELSPEED;Gobeactive=1;}else{JOY_sound(10,10);JOY_sound(50,10);}}
-}}
-if (Menreturn==1) {
-if (((Frame>=6)&&(Frame<=12))||((Frame>=18)&&(Frame<=24))) {
-return 0x00;
-}else{return mem1;}
-}else{return mem1;}}
-
-uint8_t checkDotPresent(uint8_t  DotsNumber){
-uint8_t REST=DotsNumber;
-uint8_t DOTBOOLPOSITION=0;
-DECREASE:
-if (REST>=8) {REST=REST-8;DOTBOOLPOSITION++;goto DECREASE;}
-return ((dotsMem[DOTBOOLPOSITION])&(0b10000000>>REST));
+
+void DotsReset(void){
+dotsMem[0]=0xffffffff;
+dotsMem[1]=0xffffffff;
+DotsLeft=64;
 }
 
-void DotsDestroy(uint8_t DotsNumber){
-uint8_t REST=DotsNumber;
-uint8_t DOTBOOLPOSITION=0;
-uint8_t SOUSTRAIRE;
-DECREASE:
-if (REST>=8) {REST=REST-8;DOTBOOLPOSITION=DOTBOOLPOSITION+1;goto DECREASE;}
-switch(REST){
-  case (0):SOUSTRAIRE=0b01111111;break;
-  case (1):SOUSTRAIRE=0b10111111;break;
-  case (2):SOUSTRAIRE=0b11011111;break;
-  case (3):SOUSTRAIRE=0b11101111;break;
-  case (4):SOUSTRAIRE=0b11110111;break;
-  case (5):SOUSTRAIRE=0b11111011;break;
-  case (6):SOUSTRAIRE=0b11111101;break;
-  case (7):SOUSTRAIRE=0b11111110;break;
+// eat the dots under pacman, only the page pacman's mouth is on has to be checked
+void DotsEat(PERSONAGE *Sprite){
+uint8_t y=Sprite[0].y;
+if (Sprite[0].Decalagey>5) {y++;}
+if (y>7) {return;}
+for (uint8_t i=DotsPage[y];i<DotsPage[y+1];i++){
+uint8_t x=DotsPos[i<<1];
+if ((checkDotPresent(i))&&(Sprite[0].x<x)&&(Sprite[0].x+6>x)) {
+DotsDestroy(i);
+if (checkDotPellet(i)) {TimerGobeactive=LEVELSPEED;Gobeactive=1;}else{JOY_sound(10,10);JOY_sound(50,10);}
+}}}
+
+uint32_t checkDotPresent(uint8_t  DotsNumber){
+return (dotsMem[DotsNumber>>5]&((uint32_t)1<<(DotsNumber&31)));
 }
-dotsMem[DOTBOOLPOSITION]=dotsMem[DOTBOOLPOSITION]&SOUSTRAIRE;
+
+// power pellets are the dots 0,1,12,13,50,51,62,63
+uint32_t checkDotPellet(uint8_t  DotsNumber){
+static const uint32_t PELLETS[2]={0x00003003,0xC00C0000};
+return (PELLETS[DotsNumber>>5]&((uint32_t)1<<(DotsNumber&31)));
+}
+
+void DotsDestroy(uint8_t DotsNumber){
+dotsMem[DotsNumber>>5]&=~((uint32_t)1<<(DotsNumber&31));
+DotsLeft--;
 }
 
 uint8_t SplitSpriteDecalageY(uint8_t decalage,uint8_t Input,uint8_t UPorDOWN){
@@ -453,5 +495,123 @@ return (caracters[((x-Sprite[SpriteNumber].x)+(8*(Sprite[SpriteNumber].type*12))
 }return 0;}
 
 uint8_t background(uint8_t x,uint8_t y){
-return (BackBlitz[((y)*128)+((x))]);
+return MazeByte(BackBlitz,x,y);
+}
+
+uint8_t BackRead(uint16_t pos){
+if (pos>1023) {return 0;}
+return MazeByte(back,pos&127,pos>>7);
+}
+
+// fetch byte of a maze tile map, bit 7 of a map entry mirrors the tile
+uint8_t MazeByte(const uint8_t *Map,uint8_t x,uint8_t y){
+uint8_t Tile=Map[(y<<5)+(x>>2)];
+x&=3;
+if (Tile&0x80) {x=3-x;}
+return MazeTiles[((Tile&0x7F)<<2)+x];
+}
+
+// ghosts that follow the maze graph move from node to node without wall checks
+void MazeReset(PERSONAGE *Sprite){
+for (uint8_t t=1;t<=4;t++){GhostLeave(t,Sprite);}
+GhostNode[0]=MAZE_NONE;
+MazeTarget=MAZE_NONE;
+PacNode=MAZE_NONE;
+}
+
+// sprite row -8..71 shifted to the node rows 0..79
+uint8_t MazeRow(PERSONAGE *Sprite,uint8_t t){
+return (Sprite[t].y*8)+Sprite[t].Decalagey+8;
+}
+
+// distance of position from Node along the edge in direction Dir (1 right, 3 down)
+uint8_t MazeOffset(uint8_t Node,uint8_t Dir,uint8_t x,uint8_t Row){
+const MAZENODE *N=&MazeNodes[Node];
+uint8_t Offset;
+if (N->next[Dir]==MAZE_NONE) {return MAZE_NONE;}
+if (Dir==1) {
+if (Row!=N->y) {return MAZE_NONE;}
+Offset=x-N->x;
+}else{
+if (x!=N->x) {return MAZE_NONE;}
+Offset=(Row>=N->y)?(Row-N->y):(Row+80-N->y);
+}
+if (Offset>N->len[Dir]) {return MAZE_NONE;}
+return Offset;
+}
+
+// find the node nearest to pacman, the flow field is only rebuilt when it changes
+void MazeUpdateTarget(PERSONAGE *Sprite){
+uint8_t x=Sprite[0].x;
+uint8_t Row=MazeRow(Sprite,0);
+uint8_t Offset=MAZE_NONE;
+if (PacNode!=MAZE_NONE) {Offset=MazeOffset(PacNode,PacDir,x,Row);}
+for (uint8_t n=0;(Offset==MAZE_NONE)&&(n<MAZE_NODES);n++){
+for (PacDir=1;PacDir<=3;PacDir+=2){
+Offset=MazeOffset(n,PacDir,x,Row);
+if (Offset!=MAZE_NONE) {PacNode=n;break;}
+}}
+if (Offset==MAZE_NONE) {PacNode=MAZE_NONE;return;}
+uint8_t Target=((Offset<<1)<=MazeNodes[PacNode].len[PacDir])?PacNode:MazeNodes[PacNode].next[PacDir];
+if (Target!=MazeTarget) {MazeTarget=Target;MazeFlow();}
+}
+
+// distance of every node to the target node (relaxed until stable)
+void MazeFlow(void){
+uint8_t Changed;
+for (uint8_t n=0;n<MAZE_NODES;n++){MazeDist[n]=0xFF;}
+MazeDist[MazeTarget]=0;
+do{
+Changed=0;
+for (uint8_t n=0;n<MAZE_NODES;n++){
+if (MazeDist[n]==0xFF) {continue;}
+for (uint8_t d=0;d<4;d++){
+uint8_t Next=MazeNodes[n].next[d];
+if (Next==MAZE_NONE) {continue;}
+uint8_t Dist=MazeDist[n]+MazeNodes[n].len[d];
+if (Dist<MazeDist[Next]) {MazeDist[Next]=Dist;Changed=1;}
+}}}while(Changed);
+}
+
+// back to wandering: both axes move again and walls are checked
+void GhostLeave(uint8_t t,PERSONAGE *Sprite){
+if (GhostNode[t]==MAZE_NONE) {return;}
+GhostNode[t]=MAZE_NONE;
+if (Sprite[t].DirectionV==2) {Sprite[t].DirectionV=JOY_random()%2;}
+if (Sprite[t].DirectionH==2) {Sprite[t].DirectionH=JOY_random()%2;}
+}
+
+// on a node: take the exit with the shortest way to pacman (longest while frightened),
+// one out of four decisions is random, turning back only in dead ends
+void GhostSteer(uint8_t t,PERSONAGE *Sprite){
+uint8_t x=Sprite[t].x;
+uint8_t Row=MazeRow(Sprite,t);
+uint8_t Node=GhostNode[t];
+uint8_t Back=MAZE_NONE;
+if ((Sprite[t].guber==1)||(MazeTarget==MAZE_NONE)) {GhostLeave(t,Sprite);return;}
+if (Node==MAZE_NONE) {
+for (Node=0;Node<MAZE_NODES;Node++){
+if ((MazeNodes[Node].x==x)&&(MazeNodes[Node].y==Row)) {break;}
+}
+if (Node==MAZE_NODES) {return;}
+}else{
+if ((MazeNodes[Node].x!=x)||(MazeNodes[Node].y!=Row)) {return;}
+if (Sprite[t].DirectionV!=2) {Back=Sprite[t].DirectionV^1;}else{Back=2+(Sprite[t].DirectionH^1);}
+}
+const MAZENODE *N=&MazeNodes[Node];
+uint8_t Best=MAZE_NONE;
+uint16_t Score,BestScore=0;
+uint8_t Rnd=((JOY_random()&3)==0);
+uint8_t First=JOY_random()&3;
+for (uint8_t i=0;i<4;i++){
+uint8_t d=(First+i)&3;
+if ((N->next[d]==MAZE_NONE)||(d==Back)) {continue;}
+Score=N->len[d]+MazeDist[N->next[d]];
+if ((Best==MAZE_NONE)||((Gobeactive)&&(Score>BestScore))||((!Gobeactive)&&(Score<BestScore))) {Best=d;BestScore=Score;}
+if (Rnd) {break;}
+}
+if (Best==MAZE_NONE) {Best=Back;}
+GhostNode[t]=N->next[Best];
+if (Best<2) {Sprite[t].DirectionV=Best;Sprite[t].DirectionH=2;}
+else{Sprite[t].DirectionV=2;Sprite[t].DirectionH=Best-2;}
 }
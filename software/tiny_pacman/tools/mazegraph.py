@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Project:   mazegraph - Junction Graph Generator for the Tiny Pacman Maze
+# Version:   v1.0
+# Year:      2023
+# License:   MIT License
+# ===================================================================================
+#
+# Description:
+# ------------
+# Builds the junction graph of the maze from the wall tile map in spritebank.h. The
+# sprite positions Pacman can reach are found by flood fill with the same wall tests
+# as CheckCollisionWithBack() in tiny_pacman.c, so every corridor is exactly one
+# position wide. Positions where a sprite can turn, branch or stop become nodes;
+# each node stores its neighbour node and the distance in pixels for the four
+# directions (left, right, up, down).
+#
+# Sprite rows run from -8 to 71 (page -1 to 8) and wrap around vertically; they are
+# stored with an offset of 8, so node rows are 0..79.
+#
+# Operating Instructions:
+# -----------------------
+# - python mazegraph.py [-h] [INPUT]
+#   -h, --help                show help message and exit
+#   INPUT                     spritebank.h with MazeTiles and back (default: the one
+#                             in ../include)
+#
+# - Example:
+#   python mazegraph.py > mazegraph.h
+
+
+import os
+import sys
+import argparse
+from tilemap import read_array, unpack_map, TILE_SIZE
+
+START     = (64, 29)      # Pacman start position (x, row)
+HOUSE_X   = 86            # Pacman may not move left from here on page 3 (ghost house)
+ROWS      = 80            # sprite rows -8..71
+NONE      = 0xFF          # no neighbour
+
+# ===================================================================================
+# Main Function
+# ===================================================================================
+
+def _main():
+    default = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include', 'spritebank.h')
+    parser = argparse.ArgumentParser(description='Junction graph generator for the Tiny Pacman maze')
+    parser.add_argument('input', nargs='?', default=default, help='spritebank.h with MazeTiles and back')
+    args = parser.parse_args(sys.argv[1:])
+
+    tiles = read_array(args.input, 'MazeTiles')
+    atlas = [tuple(tiles[i:i + TILE_SIZE]) for i in range(0, len(tiles), TILE_SIZE)]
+    maze  = Maze(unpack_map(atlas, read_array(args.input, 'back')))
+    nodes, links = maze.graph()
+
+    print('// %d nodes, generated with tools/mazegraph.py' % len(nodes))
+    print('#define MAZE_NODES %d' % len(nodes))
+    print('const MAZENODE  MazeNodes [] = {')
+    for i, (x, row) in enumerate(nodes):
+        nxt = ','.join('%d' % n for n, _ in links[i])
+        dst = ','.join('%d' % l for _, l in links[i])
+        print('{%d,%d,{%s},{%s}}%s' % (x, row + 8, nxt, dst, ',' if i + 1 < len(nodes) else ''))
+    print('};')
+
+# ===================================================================================
+# Maze Model
+# ===================================================================================
+
+class Maze:
+    def __init__(self, back):
+        self.back = back
+
+    # BackRead(): wall byte at linear position, outside the bitmap there are no walls
+    def read(self, pos):
+        return self.back[pos] if 0 <= pos < len(self.back) else 0
+
+    # RecupeBacktoCompV(): wall in the leading column of a sprite moving left/right
+    def hit_v(self, x, row, right):
+        y, dec = row >> 3, row & 7
+        col = x + 6 if right else x
+        y1 = self.read(y * 128 + col) & ((0x7F << dec) & 0xFF)
+        y2 = self.read((y + 1) * 128 + col) & (0x7F >> (8 - dec))
+        return (y1 | y2) != 0
+
+    # RecupeBacktoCompH(): wall under the 7 columns of a sprite moving up/down
+    def hit_h(self, x, row, down):
+        y, dec = row >> 3, row & 7
+        tadd = 1 if (down and dec > 2) else 0
+        mask = (0x7F >> (8 - dec)) if tadd else ((0x7F << dec) & 0xFF)
+        return any(mask & self.read((y + tadd) * 128 + x + t) for t in range(7))
+
+    # RefreshCaracter(): one pixel step in direction d (0 left, 1 right, 2 up, 3 down)
+    def move(self, pos, d):
+        x, row = pos
+        if d < 2:
+            if not 0 <= row < 64:
+                return None
+            if d == 0 and row >> 3 == 3 and x == HOUSE_X:
+                return None
+            nx = x + (1 if d else -1)
+            return None if self.hit_v(nx, row, d == 1) else (nx, row)
+        nrow = row + (1 if d == 3 else -1)
+        if nrow > 71:
+            nrow = -8
+        if nrow < -8:
+            nrow = 71
+        return None if self.hit_h(x, nrow, d == 3) else (x, nrow)
+
+    def graph(self):
+        reach = {START}
+        stack = [START]
+        while stack:
+            pos = stack.pop()
+            for d in range(4):
+                nxt = self.move(pos, d)
+                if nxt and nxt not in reach:
+                    reach.add(nxt)
+                    stack.append(nxt)
+        dirs = {p: [d for d in range(4) if self.move(p, d) in reach] for p in reach}
+        nodes = sorted((p for p in reach if dirs[p] not in ([0, 1], [2, 3])), key=lambda p: (p[1], p[0]))
+        index = {p: i for i, p in enumerate(nodes)}
+        if len(nodes) >= NONE:
+            raise SystemExit('ERROR: too many nodes')
+        links = []
+        for p in nodes:
+            link = []
+            for d in range(4):
+                if d not in dirs[p]:
+                    link.append((NONE, 0))
+                    continue
+                q, n = self.move(p, d), 1
+                while q not in index:
+                    q, n = self.move(q, d), n + 1
+                link.append((index[q], n))
+            links.append(link)
+        return nodes, links
+
+# ===================================================================================
+
+if __name__ == "__main__":
+    _main()
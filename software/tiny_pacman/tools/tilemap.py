@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Project:   tilemap - Tile Map Generator for SSD1306 Full-Screen Images
+# Version:   v1.0
+# Year:      2023
+# License:   MIT License
+# ===================================================================================
+#
+# Description:
+# ------------
+# Splits one or more 128x64 pixels OLED bitmaps (1024 bytes, 8 pages of 128 columns,
+# as used in the spritebank.h files) into tiles of 4 columns x 8 pixels (one page)
+# and generates a shared tile atlas plus one tile map per bitmap.
+#
+# Tile atlas: 4 bytes per tile, tile 0 is always the blank tile.
+# Tile map:   32 entries per page, 8 pages, one byte per tile:
+#             - bit 0..6: tile number in atlas
+#             - bit 7:    tile is mirrored horizontally
+# Since 128 / 4 = 32, the map entry of bitmap byte i is simply map[i >> 2].
+# Tile rows:  with -r, one byte per tile, the OR of its 4 columns. A tile whose rows
+#             miss a mask has no set pixel in these rows in any of its columns, so
+#             a collision test can accept or reject a whole tile with one lookup.
+#
+# Operating Instructions:
+# -----------------------
+# - python tilemap.py [-h] [-t TILES] [-r ROWS] INPUT ARRAY [ARRAY ...]
+#   -h, --help                show help message and exit
+#   -t TILES, --tiles TILES   name of the generated tile atlas array
+#   -r ROWS, --rows ROWS      also generate the tile rows array ROWS
+#   INPUT                     C source/header with the raw bitmap arrays
+#   ARRAY                     name of a raw bitmap array in INPUT
+#
+# - Example:
+#   python tilemap.py -t MazeTiles -r MazeRows raw_maze.h back BackBlitz > maze.h
+
+
+import re
+import sys
+import argparse
+
+PAGES     = 8             # number of pages (8 pixels high each)
+PAGE_SIZE = 128           # bytes (columns) per page
+TILE_SIZE = 4             # bytes (columns) per tile
+MAX_TILES = 128           # 7 bit tile number
+
+# ===================================================================================
+# Main Function
+# ===================================================================================
+
+def _main():
+    parser = argparse.ArgumentParser(description='Tile map generator for SSD1306 full-screen images')
+    parser.add_argument('-t', '--tiles', default='TILES', help='name of the generated tile atlas array')
+    parser.add_argument('-r', '--rows', help='also generate the tile rows array ROWS')
+    parser.add_argument('input', help='C source/header with the raw bitmap arrays')
+    parser.add_argument('arrays', nargs='+', help='names of the raw bitmap arrays')
+    args = parser.parse_args(sys.argv[1:])
+
+    bitmaps = []
+    for name in args.arrays:
+        data = read_array(args.input, name)
+        if len(data) != PAGES * PAGE_SIZE:
+            raise SystemExit('ERROR: bitmap %s must be %d bytes, got %d' % (name, PAGES * PAGE_SIZE, len(data)))
+        bitmaps.append(data)
+
+    atlas, maps = make_tiles(bitmaps)
+    for data, tmap in zip(bitmaps, maps):
+        if unpack_map(atlas, tmap) != data:
+            raise SystemExit('ERROR: verification failed')
+
+    size = len(atlas) * TILE_SIZE + sum(len(m) for m in maps)
+    if args.rows:
+        size += len(atlas)
+    print('// %d tiles, %d -> %d bytes' % (len(atlas), len(bitmaps) * PAGES * PAGE_SIZE, size))
+    print_array(args.tiles, [b for tile in atlas for b in tile], 'tile atlas, %d bytes per tile' % TILE_SIZE)
+    if args.rows:
+        print()
+        print_array(args.rows, tile_rows(atlas), 'tile rows, OR of the columns of each tile')
+    for name, tmap in zip(args.arrays, maps):
+        print()
+        print_array(name, tmap, 'tile map')
+
+# ===================================================================================
+# Tile Map Generator
+# ===================================================================================
+
+def make_tiles(bitmaps):
+    atlas = [(0,) * TILE_SIZE]
+    index = {atlas[0]: 0}
+    maps  = []
+    for data in bitmaps:
+        tmap = []
+        for i in range(0, len(data), TILE_SIZE):
+            tile = tuple(data[i:i + TILE_SIZE])
+            if tile in index:
+                tmap.append(index[tile])
+            elif tile[::-1] in index:
+                tmap.append(index[tile[::-1]] | 0x80)
+            else:
+                if len(atlas) >= MAX_TILES:
+                    raise SystemExit('ERROR: more than %d different tiles' % MAX_TILES)
+                index[tile] = len(atlas)
+                tmap.append(len(atlas))
+                atlas.append(tile)
+        maps.append(tmap)
+    return atlas, maps
+
+def tile_rows(atlas):
+    rows = []
+    for tile in atlas:
+        r = 0
+        for b in tile:
+            r |= b
+        rows.append(r)
+    return rows
+
+def unpack_map(atlas, tmap):
+    out = []
+    for entry in tmap:
+        tile = atlas[entry & 0x7F]
+        out += tile[::-1] if entry & 0x80 else tile
+    return out
+
+# ===================================================================================
+# C Array Input/Output
+# ===================================================================================
+
+def read_array(filename, name):
+    with open(filename) as f:
+        src = f.read()
+    m = re.search(r'\b' + re.escape(name) + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', src, re.S)
+    if not m:
+        raise SystemExit('ERROR: array %s not found in %s' % (name, filename))
+    body = re.sub(r'//[^\n]*', '', m.group(1))
+    return [int(v, 0) & 0xFF for v in re.findall(r'0x[0-9a-fA-F]+|0b[01]+|\d+', body)]
+
+def print_array(name, data, comment):
+    print('// %s' % comment)
+    print('const uint8_t %s[] = {' % name)
+    for i in range(0, len(data), 16):
+        line = ', '.join('0x%02X' % b for b in data[i:i + 16])
+        print('  ' + line + (',' if i + 16 < len(data) else ''))
+    print('};')
+
+# ===================================================================================
+
+if __name__ == "__main__":
+    _main()
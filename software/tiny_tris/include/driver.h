@@ -15,6 +15,8 @@ extern "C" {
 #include "system.h"
 #include "gpio.h"
 #include "oled_min.h"
+#include "pack.h"
+#include "kvstore.h"
 
 // Pin assignments
 #define PIN_ACT     PA2   // pin connected to fire button
@@ -37,10 +39,16 @@ extern "C" {
 // Sound enable
 #define JOY_SOUND   1     // 0: no sound, 1: with sound
 
+// Keys of the driver settings in the flash store, games use JOY_KEY_GAME and up
+#define JOY_KEY_SOUND     0       // 0: sound off, else (or never set) on
+#define JOY_KEY_CAL       1       // ADC reading of joypad LEFT on this unit
+#define JOY_KEY_GAME      2       // first key free for the game
+
 // Game slow-down delay
 #define JOY_SLOWDOWN()    //DLY_ms(10)
 
 // Init driver
+void JOY_settings(void);
 static inline void JOY_init(void) {
   PIN_input_AN(PIN_PAD);
   PIN_input_PU(PIN_ACT);
@@ -49,6 +57,7 @@ static inline void JOY_init(void) {
   OLED_init();
   ADC_init();
   ADC_input(PIN_PAD);
+  JOY_settings();
 }
 
 // OLED commands
@@ -57,6 +66,8 @@ static inline void JOY_init(void) {
 #define JOY_OLED_send(b)          I2C_write(b)
 #define JOY_OLED_send_command(c)  OLED_send_command(c)
 #define JOY_OLED_data_start(y)    {OLED_setpos(0,y);OLED_data_start();}
+#define JOY_OLED_data_start_at(x,y) {OLED_setpos(x,y);OLED_data_start();}
+#define JOY_OLED_draw_packed(p)   PACK_draw(p)
 
 // Buttons
 #define JOY_act_pressed()         (!PIN_read(PIN_ACT))
@@ -65,39 +76,48 @@ static inline void JOY_init(void) {
 #define JOY_pad_released()        (ADC_read() <= 10)
 #define JOY_all_released()        (JOY_act_released() && JOY_pad_released())
 
+// Read direction buttons, scaled by the calibration (8.8 fixed point)
+uint16_t JOY_scale = 256;
+static inline uint16_t JOY_read(void) {
+  uint16_t val = ADC_read();
+  if(JOY_scale != 256) val = ((uint32_t)val * JOY_scale) >> 8;
+  return val;
+}
+
 static inline uint8_t JOY_up_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_N  - JOY_DEV) && (val < JOY_N  + JOY_DEV))
          | ((val > JOY_NE - JOY_DEV) && (val < JOY_NE + JOY_DEV))
          | ((val > JOY_NW - JOY_DEV) && (val < JOY_NW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_down_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_S  - JOY_DEV) && (val < JOY_S  + JOY_DEV))
          | ((val > JOY_SE - JOY_DEV) && (val < JOY_SE + JOY_DEV))
          | ((val > JOY_SW - JOY_DEV) && (val < JOY_SW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_left_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_W  - JOY_DEV) && (val < JOY_W  + JOY_DEV))
          | ((val > JOY_NW - JOY_DEV) && (val < JOY_NW + JOY_DEV))
          | ((val > JOY_SW - JOY_DEV) && (val < JOY_SW + JOY_DEV)) );
 }
 
 static inline uint8_t JOY_right_pressed(void) {
- uint16_t val = ADC_read();
+ uint16_t val = JOY_read();
  return(   ((val > JOY_E  - JOY_DEV) && (val < JOY_E  + JOY_DEV))
          | ((val > JOY_NE - JOY_DEV) && (val < JOY_NE + JOY_DEV))
          | ((val > JOY_SE - JOY_DEV) && (val < JOY_SE + JOY_DEV)) );
 }
 
 // Buzzer
+uint8_t JOY_mute;
 void JOY_sound(uint8_t freq, uint8_t dur) {
   while(dur--) {
     #if JOY_SOUND == 1
-    if(freq) PIN_low(PIN_BEEP);
+    if(freq && !JOY_mute) PIN_low(PIN_BEEP);
     #endif
     DLY_us(255 - freq);
     PIN_high(PIN_BEEP);
@@ -105,6 +125,26 @@ void JOY_sound(uint8_t freq, uint8_t dur) {
   }
 }
 
+// Load the settings from the flash store. Holding fire at power-up toggles the
+// sound, holding LEFT stores its reading as the calibration of this unit.
+void JOY_settings(void) {
+  uint16_t val;
+  KV_init();
+  if(JOY_act_pressed()) {
+    KV_set(JOY_KEY_SOUND, !KV_get(JOY_KEY_SOUND));
+    while(JOY_act_pressed());
+  }
+  val = ADC_read();
+  if((val > JOY_W - 2 * JOY_DEV) && (val < JOY_W + 2 * JOY_DEV)) {
+    KV_set(JOY_KEY_CAL, val);
+    while(JOY_pad_pressed());
+  }
+  KV_commit();
+  JOY_mute = !KV_get(JOY_KEY_SOUND);
+  val = KV_get(JOY_KEY_CAL);
+  if(val != KV_EMPTY) JOY_scale = ((uint32_t)JOY_W << 8) / val;
+}
+
 // Pseudo random number generator
 uint16_t rnval = 0xACE1;
 uint16_t JOY_random(void) {
@@ -68,6 +68,20 @@ void OLED_setpos(uint8_t x, uint8_t y) {
   I2C_stop();                             // stop transmission
 }
 
+// OLED set window (columns x0..x1, pages y0..y1) and cursor to its start,
+// data wraps within the window, (0, 0, 127, 7) is the whole screen
+void OLED_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) {
+  I2C_start(OLED_ADDR);                   // start transmission to OLED
+  I2C_write(OLED_CMD_MODE);               // set command mode
+  I2C_write(OLED_COLUMNS);                // set start and end column
+  I2C_write(x0);
+  I2C_write(x1);
+  I2C_write(OLED_PAGES);                  // set start and end page
+  I2C_write(y0);
+  I2C_write(y1);
+  I2C_stop();                             // stop transmission
+}
+
 // OLED fill screen
 void OLED_fill(uint8_t p) {
   OLED_setpos(0, 0);                      // set cursor to display start
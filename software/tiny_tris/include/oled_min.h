@@ -62,6 +62,7 @@ void OLED_data_start(void);
 void OLED_command_start(void);
 void OLED_send_command(uint8_t cmd);
 void OLED_setpos(uint8_t x, uint8_t y);
+void OLED_window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
 void OLED_fill(uint8_t p);
 void OLED_draw_bmp(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, const uint8_t* bmp);
 
@@ -0,0 +1,62 @@
+// ===================================================================================
+// Packed Bitmap Decoder for SSD1306 Full-Screen Images                       * v1.0 *
+// ===================================================================================
+//
+// Decodes 128x64 pixels bitmaps that were compressed on the host with
+// tools/bmppack.py. The decoder runs as a stream: every call of PACK_read() returns
+// the next bitmap byte in OLED page order, so an image never has to be unpacked
+// into RAM. Only the last 128 decoded bytes are kept as back-reference window.
+//
+// Layer bitmaps that are looked up per byte while the screen is composed use the
+// indexed RLE format instead (bmppack.py -i). A cursor remembers the packet of the
+// last lookup, so reading a page from left to right costs O(1) per byte; a jump
+// backwards, to another page or to another 32 columns segment restarts at the
+// segment offset stored in the run directory and skips at most 32 columns of packets.
+//
+// Functions available:
+// --------------------
+// PACK_start(s, pak)       Start decoding packed bitmap pak with stream s
+// PACK_read(s)             Return next decoded byte of stream s
+// PACK_draw(pak)           Decode packed bitmap pak page by page to the OLED
+// PACK_open(c, pak)        Attach cursor c to indexed RLE bitmap pak
+// PACK_get(c, x, y)        Return byte at column x, page y of bitmap of cursor c
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Packed bitmap stream
+typedef struct PACK_stream {
+  const uint8_t* src;             // next packed byte
+  uint8_t hdr;                    // header of current packet
+  uint8_t cnt;                    // bytes left in current packet
+  uint8_t dist;                   // back-reference distance of current copy packet
+  uint8_t pos;                    // write position in window
+  uint8_t win[128];               // last 128 decoded bytes
+} PACK_stream;
+
+// Indexed bitmap cursor
+#define PACK_SEG_SHIFT  5                 // 32 columns per run directory entry
+
+typedef struct PACK_cursor {
+  const uint8_t* pak;             // indexed RLE bitmap
+  const uint8_t* src;             // header of current packet
+  uint8_t page;                   // page of current packet
+  uint8_t start;                  // first column of current packet
+  uint8_t end;                    // first column after current packet
+} PACK_cursor;
+
+// Functions
+void PACK_start(PACK_stream* s, const uint8_t* pak);
+uint8_t PACK_read(PACK_stream* s);
+void PACK_draw(const uint8_t* pak);
+void PACK_open(PACK_cursor* c, const uint8_t* pak);
+uint8_t PACK_get(PACK_cursor* c, uint8_t x, uint8_t y);
+
+#ifdef __cplusplus
+};
+#endif
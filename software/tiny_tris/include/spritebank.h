@@ -30,6 +30,7 @@ const uint8_t  H_Grid_TTTRIS[] = {
 7,7,8,8,8,9,9,9,10,10,10,11,11,11,12,12,12  
 };
 
+// pieces in rotation 0, source of Rot_TTRIS (tools/rotgen.py)
 const uint8_t Pieces_TTRIS[] = {
 //0
 0b00000000,
@@ -75,6 +76,17 @@ const uint8_t Pieces_TTRIS[] = {
 0b00000000
 };
 
+// piece rotations as row masks (bit x = column x), generated with tools/rotgen.py
+const uint8_t  Rot_TTRIS[] = {
+0x00,0x04,0x0E,0x00,0x00,0x00,0x04,0x0C,0x04,0x00,0x00,0x00,0x0E,0x04,0x00,0x00,0x04,0x06,0x04,0x00,  // 0
+0x00,0x00,0x0C,0x0C,0x00,0x00,0x00,0x06,0x06,0x00,0x00,0x06,0x06,0x00,0x00,0x00,0x0C,0x0C,0x00,0x00,  // 1
+0x00,0x00,0x0C,0x06,0x00,0x00,0x02,0x06,0x04,0x00,0x00,0x0C,0x06,0x00,0x00,0x00,0x04,0x0C,0x08,0x00,  // 2
+0x00,0x08,0x0C,0x04,0x00,0x00,0x00,0x06,0x0C,0x00,0x00,0x04,0x06,0x02,0x00,0x00,0x06,0x0C,0x00,0x00,  // 3
+0x04,0x04,0x04,0x04,0x00,0x00,0x00,0x1E,0x00,0x00,0x00,0x04,0x04,0x04,0x04,0x00,0x00,0x0F,0x00,0x00,  // 4
+0x00,0x04,0x04,0x06,0x00,0x00,0x02,0x0E,0x00,0x00,0x00,0x0C,0x04,0x04,0x00,0x00,0x00,0x0E,0x08,0x00,  // 5
+0x00,0x04,0x04,0x0C,0x00,0x00,0x00,0x0E,0x02,0x00,0x00,0x06,0x04,0x04,0x00,0x00,0x08,0x0E,0x00,0x00   // 6
+};
+
 const uint8_t  tiny_PREVIEW_block_TTTRIS[] = {
 2,1,
 0b11000000,
@@ -86,6 +98,13 @@ const uint8_t  tinyblock_TTTRIS[] = {
 0x07,0x05,0x07
 };
 
+const uint8_t  tinyghost_TTTRIS[] = {
+3,1,
+0b10100000,
+0b00000000,
+0b10100000
+};
+
 const uint8_t  tinyblock2_TTTRIS[] = {
 3,1,
 0b11100000,
@@ -137,59 +156,58 @@ const uint8_t  chateau_TTRIS [] = {
 0x30,0x30,0x30,0x30,0x38,0x38,0x3C,0x1F
 };
 
+// 'BACKGROUND_TTRIS', 128x64px, indexed RLE packed with tools/bmppack.py -i
 const uint8_t  BACKGROUND_TTRIS [] = {
-0xFC,0x02,0xF9,0xF5,0x1D,0x0D,0x0D,0x0D,0x0D,0x0B,0x07,0x1F,0x3F,0x20,0x2F,0x2F,0x3F,0x22,0x3F,0x20,
-0x39,0x33,0x20,0x3F,0x20,0x2A,0x2E,0x3F,0x2D,0x2A,0x2A,0x36,0x1F,0x07,0x0B,0x0D,0x0D,0x0D,0x0D,0x1D,
-0xF5,0xF9,0x02,0xFC,0xF8,0x00,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,
-0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,0x00,0x40,0x40,
-0x00,0x40,0x00,0xF8,0xFC,0x02,0xF9,0xF5,0x1D,0x0D,0x0D,0x0B,0x07,0x1F,0x3F,0x2D,0x2A,0x2A,0x36,0x3F,
-0x31,0x2E,0x2E,0x3F,0x31,0x2E,0x2E,0x31,0x3F,0x20,0x3A,0x32,0x2D,0x3F,0x20,0x2A,0x2E,0x3F,0x1F,0x07,
-0x0B,0x0D,0x0D,0x1D,0xF5,0xF9,0x02,0xFC,0xFF,0x00,0x7F,0xBF,0xE0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
-0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
-0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE0,0xBF,0x7F,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x7F,0xBF,0xE0,0xC0,0xC0,0xC0,
-0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
-0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE0,0xBF,0x7F,0x00,0xFF,0x00,0x01,0xFA,0x5A,
-0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0xDA,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,
-0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0xFA,0x01,0x00,
-0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
-0x00,0x01,0xFA,0xFA,0x5A,0x5A,0x5A,0x7A,0x5A,0x5A,0x5A,0x7A,0x5A,0x5A,0x5A,0x7A,0x5A,0x5A,0x5A,0x7A,
-0x5A,0x5A,0x5A,0x7A,0xDA,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,
-0x5A,0xFA,0x01,0x00,0x00,0x00,0xFF,0x55,0x77,0x55,0xDD,0x55,0x77,0x55,0xDD,0xF5,0xFF,0x3F,0x07,0xE0,
-0xFC,0xBC,0xE0,0x81,0x07,0x1D,0x7D,0xD5,0x77,0x55,0xDD,0x55,0x77,0x55,0xDD,0x55,0x77,0x55,0xDD,0x55,
-0x77,0x55,0xDD,0x55,0x77,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0xFE,0xFD,0x07,0x03,0x03,0x03,0x03,0x03,
-0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x07,0xFD,0xFE,0x00,0x01,0xFF,0xF7,0xD5,0xDD,0xD5,0xF7,
-0xD5,0xDD,0xD5,0xF7,0xD5,0xDD,0xD5,0x77,0x55,0xFF,0x00,0x00,0x00,0x00,0xFF,0x55,0x77,0x55,0xDD,0xF5,
-0x7F,0x3F,0x8F,0xC3,0xF0,0xDC,0xBF,0xF7,0xEF,0xFD,0xEA,0xD7,0xBC,0xF0,0x40,0x81,0x07,0x1D,0x75,0x3F,
-0x87,0xF1,0x81,0x03,0x0F,0x35,0xDD,0x55,0x77,0x55,0xDD,0x55,0x77,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,
-0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x7E,0xC2,0x5E,0x7E,
-0x42,0x52,0x5A,0x7E,0x62,0x5E,0x62,0x7E,0x42,0x52,0x5A,0x7E,0xC2,0x5E,0xFC,0x01,0x03,0xFF,0x00,0x00,
-0x00,0x00,0xFF,0x55,0x77,0x55,0xDF,0x57,0x7C,0xF8,0xE1,0x04,0x2A,0xEE,0xDA,0x4E,0x0A,0x0A,0x0E,0x1A,
-0xAE,0x0A,0x05,0x01,0xC0,0x60,0x78,0x6F,0x5F,0x7E,0x75,0x6F,0x58,0x60,0xC0,0x03,0x0F,0x75,0xDD,0x55,
-0x77,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xFF,0x00,0x00,0xFF,0x78,0x73,0xE5,0x67,0x66,0x66,0xE6,0x66,0x66,0x6E,0xFE,0xFE,0x0E,
-0x06,0xC6,0x00,0xFF,0xFF,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x80,0xFF,0xFF,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x0F,0x15,0x17,0x95,0x1D,0x15,0x97,0x1F,0x9F,0x00,
-0x09,0xBF,0x3A,0x95,0x20,0x00,0x91,0x00,0xAA,0x00,0x00,0x80,0x02,0x85,0x37,0x2D,0x95,0x07,0x85,0x0D,
-0x37,0x85,0x02,0x80,0x18,0x1C,0x9F,0x15,0x17,0x0F,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x0F,0x17,0x15,0x9D,0x15,0x17,
-0x95,0x1D,0x95,0x17,0x15,0x7F,0x3F,0x80,0x00,0x1D,0x94,0x19,0x9A,0x13,0x13,0x93,0x13,0x93,0x13,0x17,
-0x7F,0x3F,0x87,0x03,0x13,0x93,0x13,0x93,0x13,0x12,0x91,0x10,0x18,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
-0x06,0x0F,0x0D,0x1F,0x1D,0x16,0x1F,0x1D,0x1F,0x1D,0x36,0x3F,0x3D,0x7F,0x7D,0x76,0xFF,0xFD,0xFF,0xFD,
-0x76,0x7F,0x7D,0x3F,0x3D,0x36,0x1F,0x1D,0x1F,0x1D,0x16,0x1F,0x1D,0x0F,0x0D,0x06,0x00,0x00,0x00,0x00,
-0xFF,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
-0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xFF,
-0x00,0x00,0x00,0x00,0x06,0x0F,0x0D,0x1F,0x1D,0x16,0x1F,0x1D,0x1F,0x1D,0x36,0x3F,0x3D,0x7F,0x7D,0x76,
-0xFF,0xFD,0xFF,0xFD,0x76,0x7F,0x7D,0x3F,0x3D,0x36,0x1F,0x1D,0x1F,0x1D,0x16,0x1F,0x1D,0x0F,0x0D,0x06,
-0x00,0x00,0x00,0x00
+0x28,0x00,0xBA,0x00,0xE0,0x00,0x43,0x01,0x9D,0x01,0xF8,0x01,0x56,0x02,0xBC,0x02,
+0x22,0x47,0x6E,0x08,0x13,0x1E,0x22,0x32,0x42,0x21,0x32,0x40,0x21,0x32,0x3F,0x22,
+0x33,0x45,0x22,0x33,0x44,0x1F,0x2E,0x3D,0x04,0xFC,0x02,0xF9,0xF5,0x1D,0x82,0x0D,
+0x04,0x0B,0x07,0x1F,0x3F,0x20,0x80,0x2F,0x0C,0x3F,0x22,0x3F,0x20,0x39,0x33,0x20,
+0x3F,0x20,0x2A,0x2E,0x3F,0x2D,0x80,0x2A,0x00,0x36,0x02,0x1F,0x07,0x0B,0x82,0x0D,
+0x08,0x1D,0xF5,0xF9,0x02,0xFC,0xF8,0x00,0x40,0x00,0x80,0x40,0x00,0x00,0x80,0x40,
+0x00,0x00,0x80,0x40,0x00,0x00,0x80,0x40,0x00,0x00,0x80,0x40,0x01,0x00,0x40,0x01,
+0x40,0x00,0x80,0x40,0x00,0x00,0x80,0x40,0x00,0x00,0x80,0x40,0x00,0x00,0x80,0x40,
+0x00,0x00,0x80,0x40,0x08,0x00,0x40,0x00,0xF8,0xFC,0x02,0xF9,0xF5,0x1D,0x80,0x0D,
+0x04,0x0B,0x07,0x1F,0x3F,0x2D,0x80,0x2A,0x02,0x36,0x3F,0x31,0x80,0x2E,0x01,0x3F,
+0x31,0x80,0x2E,0x0D,0x31,0x3F,0x20,0x3A,0x32,0x2D,0x3F,0x20,0x2A,0x2E,0x3F,0x1F,
+0x07,0x0B,0x80,0x0D,0x04,0x1D,0xF5,0xF9,0x02,0xFC,0x04,0xFF,0x00,0x7F,0xBF,0xE0,
+0x99,0xC0,0x85,0xC0,0x03,0xE0,0xBF,0x7F,0x00,0x80,0xFF,0x91,0x00,0x91,0x00,0x80,
+0xFF,0x03,0x00,0x7F,0xBF,0xE0,0x85,0xC0,0x99,0xC0,0x04,0xE0,0xBF,0x7F,0x00,0xFF,
+0x0D,0x00,0x01,0xFA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0x80,
+0xDA,0x0F,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,
+0xDA,0x5A,0x0C,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0xFA,0x01,0x00,0xFF,
+0x91,0x00,0x91,0x00,0x02,0xFF,0x00,0x01,0x80,0xFA,0x81,0x5A,0x00,0x7A,0x81,0x5A,
+0x00,0x7A,0x81,0x5A,0x00,0x7A,0x81,0x5A,0x00,0x7A,0x81,0x5A,0x00,0x7A,0x80,0xDA,
+0x11,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,0xDA,0x5A,0x7A,0x5A,
+0xFA,0x01,0x00,0x80,0x00,0x1D,0xFF,0x55,0x77,0x55,0xDD,0x55,0x77,0x55,0xDD,0xF5,
+0xFF,0x3F,0x07,0xE0,0xFC,0xBC,0xE0,0x81,0x07,0x1D,0x7D,0xD5,0x77,0x55,0xDD,0x55,
+0x77,0x55,0xDD,0x55,0x09,0x77,0x55,0xDD,0x55,0x77,0x55,0xDD,0x55,0x77,0xFF,0x80,
+0x00,0x00,0xFF,0x91,0x00,0x91,0x00,0x00,0xFF,0x80,0x00,0x04,0xFF,0x00,0xFE,0xFD,
+0x07,0x83,0x03,0x87,0x03,0x14,0x07,0xFD,0xFE,0x00,0x01,0xFF,0xF7,0xD5,0xDD,0xD5,
+0xF7,0xD5,0xDD,0xD5,0xF7,0xD5,0xDD,0xD5,0x77,0x55,0xFF,0x80,0x00,0x80,0x00,0x1D,
+0xFF,0x55,0x77,0x55,0xDD,0xF5,0x7F,0x3F,0x8F,0xC3,0xF0,0xDC,0xBF,0xF7,0xEF,0xFD,
+0xEA,0xD7,0xBC,0xF0,0x40,0x81,0x07,0x1D,0x75,0x3F,0x87,0xF1,0x81,0x03,0x09,0x0F,
+0x35,0xDD,0x55,0x77,0x55,0xDD,0x55,0x77,0xFF,0x80,0x00,0x00,0xFF,0x91,0x00,0x91,
+0x00,0x00,0xFF,0x80,0x00,0x01,0xFF,0x00,0x80,0xFF,0x84,0x00,0x85,0x00,0x16,0xFC,
+0x7E,0xC2,0x5E,0x7E,0x42,0x52,0x5A,0x7E,0x62,0x5E,0x62,0x7E,0x42,0x52,0x5A,0x7E,
+0xC2,0x5E,0xFC,0x01,0x03,0xFF,0x80,0x00,0x80,0x00,0x0D,0xFF,0x55,0x77,0x55,0xDF,
+0x57,0x7C,0xF8,0xE1,0x04,0x2A,0xEE,0xDA,0x4E,0x80,0x0A,0x0D,0x0E,0x1A,0xAE,0x0A,
+0x05,0x01,0xC0,0x60,0x78,0x6F,0x5F,0x7E,0x75,0x6F,0x09,0x58,0x60,0xC0,0x03,0x0F,
+0x75,0xDD,0x55,0x77,0xFF,0x80,0x00,0x00,0xFF,0x91,0x00,0x91,0x00,0x00,0xFF,0x80,
+0x00,0x04,0xFF,0x78,0x73,0xE5,0x67,0x80,0x66,0x00,0xE6,0x80,0x66,0x00,0x6E,0x80,
+0xFE,0x03,0x0E,0x06,0xC6,0x00,0x80,0xFF,0x00,0x80,0x8C,0x00,0x00,0x80,0x80,0xFF,
+0x80,0x00,0x00,0xFF,0x80,0x00,0x80,0x00,0x12,0x0F,0x15,0x17,0x95,0x1D,0x15,0x97,
+0x1F,0x9F,0x00,0x09,0xBF,0x3A,0x95,0x20,0x00,0x91,0x00,0xAA,0x80,0x00,0x08,0x80,
+0x02,0x85,0x37,0x2D,0x95,0x07,0x85,0x0D,0x09,0x37,0x85,0x02,0x80,0x18,0x1C,0x9F,
+0x15,0x17,0x0F,0x80,0x00,0x00,0xFF,0x91,0x00,0x91,0x00,0x00,0xFF,0x80,0x00,0x09,
+0x0F,0x17,0x15,0x9D,0x15,0x17,0x95,0x1D,0x95,0x17,0x08,0x15,0x7F,0x3F,0x80,0x00,
+0x1D,0x94,0x19,0x9A,0x80,0x13,0x12,0x93,0x13,0x93,0x13,0x17,0x7F,0x3F,0x87,0x03,
+0x13,0x93,0x13,0x93,0x13,0x12,0x91,0x10,0x18,0x0F,0x80,0x00,0x82,0x00,0x1B,0x06,
+0x0F,0x0D,0x1F,0x1D,0x16,0x1F,0x1D,0x1F,0x1D,0x36,0x3F,0x3D,0x7F,0x7D,0x76,0xFF,
+0xFD,0xFF,0xFD,0x76,0x7F,0x7D,0x3F,0x3D,0x36,0x1F,0x1D,0x07,0x1F,0x1D,0x16,0x1F,
+0x1D,0x0F,0x0D,0x06,0x82,0x00,0x00,0xFF,0x91,0x80,0x91,0x80,0x00,0xFF,0x82,0x00,
+0x07,0x06,0x0F,0x0D,0x1F,0x1D,0x16,0x1F,0x1D,0x1B,0x1F,0x1D,0x36,0x3F,0x3D,0x7F,
+0x7D,0x76,0xFF,0xFD,0xFF,0xFD,0x76,0x7F,0x7D,0x3F,0x3D,0x36,0x1F,0x1D,0x1F,0x1D,
+0x16,0x1F,0x1D,0x0F,0x0D,0x06,0x82,0x00
 };
 
 #ifdef __cplusplus
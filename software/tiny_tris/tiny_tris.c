@@ -33,7 +33,7 @@
 // ===================================================================================
 // Global Variables
 // ===================================================================================
-uint8_t Grid_TTRIS[12][3]={{0}};
+uint16_t Grid_TTRIS[19]={0};
 const uint8_t  MEM_TTTRIS[16]= {0,2,0,4,3,7,6,9,9,12,11,15,14,17,17,19};
 uint8_t Level_TTRIS;
 uint16_t Scores_TTRIS;
@@ -47,7 +47,7 @@ uint8_t DROP_SPEED_TTRIS;
 uint8_t SPEED_x_trig_TTRIS;
 uint8_t DROP_TRIG_TTRIS;
 int8_t xx_TTRIS,yy_TTRIS;
-uint8_t Piece_Mat2_TTRIS[5][5];
+uint8_t Piece_Rows_TTRIS[5];
 uint8_t Ripple_filter_TTRIS;
 uint8_t PIECEs_TTRIS;
 uint8_t PIECEs_TTRIS_PREVIEW;
@@ -59,6 +59,29 @@ uint8_t OU_SUIS_JE_X_ENGAGED_TTRIS;
 uint8_t OU_SUIS_JE_Y_ENGAGED_TTRIS;
 int8_t DEPLACEMENT_XX_TTRIS;
 int8_t DEPLACEMENT_YY_TTRIS;
+PACK_cursor BACKGROUND_CURSOR_TTRIS;
+uint8_t Field_TTRIS[8][36];
+uint8_t Field_Dirty_TTRIS;
+uint8_t Span_L_TTRIS[8];
+uint8_t Span_R_TTRIS[8];
+int8_t Drawn_xx_TTRIS,Drawn_yy_TTRIS;
+int8_t GHOST_YY_TTRIS,Drawn_gy_TTRIS;
+uint8_t HARD_DROP_TTRIS;
+uint8_t LINE_MEM_TTRIS[19];
+uint8_t CLEAR_TIMER_TTRIS;
+uint8_t SPAWN_TTRIS;
+uint8_t SWEEP_TTRIS;
+
+// wall kicks tried in this order when a rotation collides, in cells (x,y)
+const int8_t Kick_TTRIS[5][2]={{0,0},{-1,0},{1,0},{-2,0},{2,0}};
+
+#define FRAME_DLY_TTRIS 3
+#define CLEAR_PHASE_TTRIS 6
+
+// keys of the records in the flash store
+#define KV_SCORE_TTRIS JOY_KEY_GAME
+#define KV_LINES_TTRIS (JOY_KEY_GAME+1)
+#define KV_LEVEL_TTRIS (JOY_KEY_GAME+2)
 
 // ===================================================================================
 // Function Prototypes
@@ -74,25 +97,33 @@ void Game_Play_TTRIS(void);
 uint8_t End_Play_TTRIS(void);
 void DELETE_LINE_TTRIS(void);
 uint8_t Calcul_of_Score_TTRIS(uint8_t Tmp_TTRIS);
-void FLASH_LINE_TTRIS(uint8_t *PASS_LINE);
+void Clear_Step_TTRIS(void);
+void Frame_Wait_TTRIS(void);
 void PAINT_LINE_TTRIS(uint8_t VISIBLE,uint8_t *PASS_LINE);
 void Clean_Grid_TTRIS(uint8_t *PASS_LINE);
 uint8_t CHECK_if_Rot_Ok_TTRIS(uint8_t *Rot_TTRIS);
 uint8_t Check_collision_x_TTRIS(int8_t x_Axe);
 uint8_t Check_collision_y_TTRIS(int8_t y_Axe);
+uint8_t Check_collision_TTRIS(int8_t x_Axe,int8_t y_Axe);
+uint32_t Row_Mask_TTRIS(int8_t Y_SCAN);
 void Move_Piece_TTRIS(void);
 void Ou_suis_Je_TTRIS(int8_t xx_,int8_t yy_);
 void Select_Piece_TTRIS(uint8_t Piece_);
 void rotate_Matrix_TTRIS(uint8_t ROT);
-uint8_t Scan_Piece_Matrix_TTRIS(int8_t x_Mat,int8_t y_Mat);
-uint8_t GRID_STAT_TTRIS(int8_t X_SCAN,int8_t Y_SCAN);
-uint8_t CHANGE_GRID_STAT_TTRIS(int8_t X_SCAN,int8_t Y_SCAN,uint8_t VALUE);
 uint8_t blitzSprite_TTRIS(int8_t xPos,int8_t yPos,uint8_t xPASS,uint8_t yPASS,uint8_t FRAME,const uint8_t *SPRITES);
 uint8_t H_grid_Scan_TTRIS(uint8_t xPASS);
 uint8_t Recupe_TTRIS(uint8_t xPASS,uint8_t yPASS);
+void Raster_Page_TTRIS(uint8_t yPASS);
+void Mark_Rows_TTRIS(int8_t Y0,int8_t Y1);
+void Mark_Span_TTRIS(int8_t X0,int8_t X1,int8_t Y0,int8_t Y1);
+void Mark_Piece_TTRIS(void);
+void Mark_Box_TTRIS(int8_t X,int8_t Y);
+void Ghost_TTRIS(void);
+void Flush_TTRIS(void);
 uint8_t NEXT_BLOCK_TTRIS(uint8_t xPASS,uint8_t yPASS);
 uint8_t RECUPE_BACKGROUND_TTRIS(uint8_t xPASS,uint8_t yPASS);
 uint8_t DropPiece_TTRIS(uint8_t xPASS,uint8_t yPASS);
+uint8_t GhostPiece_TTRIS(uint8_t xPASS,uint8_t yPASS);
 uint8_t SplitSpriteDecalageY_TTRIS(uint8_t decalage,uint8_t Input,uint8_t UPorDOWN);
 uint8_t RecupeLineY_TTRIS(uint8_t Valeur);
 uint8_t RecupeDecalageY_TTRIS(uint8_t Valeur);
@@ -110,7 +141,6 @@ void recupe_HIGHSCORE_TTRIS(void);
 void Reset_Value_TTRIS(void);
 void save_HIGHSCORE_TTRIS(void);
 void Check_NEW_RECORD(void);
-uint8_t checksum(uint8_t Byte_);
 
 // ===================================================================================
 // Main Function
@@ -118,6 +148,7 @@ uint8_t checksum(uint8_t Byte_);
 int main(void) {
 // Setup
 JOY_init();
+PACK_open(&BACKGROUND_CURSOR_TTRIS,BACKGROUND_TTRIS);
 
 // Loop
 while(1) {
@@ -129,7 +160,6 @@ save_HIGHSCORE_TTRIS();}
 }
 MENU:;
 uint8_t Rot_TTRIS=0;
-uint8_t SKIP_FRAME=0;
 INIT_ALL_VAR_TTRIS();
 Game_Play_TTRIS();
 Ou_suis_Je_TTRIS(xx_TTRIS,yy_TTRIS);
@@ -138,24 +168,33 @@ SETUP_NEW_PREVIEW_PIECE_TTRIS(&Rot_TTRIS);
 Tiny_Flip_TTRIS(128);
 JOY_DLY_ms(1000);
 xx_TTRIS=55;yy_TTRIS=5;
+Ghost_TTRIS();
 while(1){ 
-CONTROLE_TTRIS(&Rot_TTRIS);
-if (DROP_BREAK_TTRIS==6) {
-  END_DROP_TTRIS();
+if (CLEAR_TIMER_TTRIS) {
+  Clear_Step_TTRIS();
+  }else{
+if (SPAWN_TTRIS) {
+  SPAWN_TTRIS=0;
   if (End_Play_TTRIS()) {  Tiny_Flip_TTRIS(128);SND_TTRIS(3); JOY_DLY_ms(2000);Check_NEW_RECORD();goto MENU;}
   yy_TTRIS=2;xx_TTRIS=55;
   PIECEs_TTRIS=PIECEs_TTRIS_PREVIEW;
   SETUP_NEW_PREVIEW_PIECE_TTRIS(&Rot_TTRIS);
   DOWN_DESACTIVE_TTRIS=1; 
+  Ghost_TTRIS();
   Tiny_Flip_TTRIS(128);
   Game_Play_TTRIS();
   Tiny_Flip_TTRIS(128);
   } 
+CONTROLE_TTRIS(&Rot_TTRIS);
+if (DROP_BREAK_TTRIS==6) {END_DROP_TTRIS();SPAWN_TTRIS=1;}
+if (SPAWN_TTRIS==0) {Move_Piece_TTRIS();Ghost_TTRIS();}
+}
    
 if ((JOY_act_pressed())&&(Ripple_filter_TTRIS==0)) {PSEUDO_RND_TTRIS();Ripple_filter_TTRIS=1;}
 
-Move_Piece_TTRIS();
-if (SKIP_FRAME==6) {Tiny_Flip_TTRIS(82);SKIP_FRAME=0;}else{SKIP_FRAME++;}
+Mark_Piece_TTRIS();
+Flush_TTRIS();
+Frame_Wait_TTRIS();
 }}}
 
 // ===================================================================================
@@ -203,9 +242,10 @@ void END_DROP_TTRIS(void){
   uint8_t x,y;
   DROP_BREAK_TTRIS=0;
   for (y=0;y<5;y++){
-  for (x=0;x<5;x++){
-  if (Piece_Mat2_TTRIS[x][y]==1) {CHANGE_GRID_STAT_TTRIS(OU_SUIS_JE_X_TTRIS+(x),OU_SUIS_JE_Y_TTRIS+(y),1);}
-  }}
+  x=OU_SUIS_JE_Y_TTRIS+y;
+  if (x<19) {Grid_TTRIS[x]|=(((uint32_t)Piece_Rows_TTRIS[y]<<(OU_SUIS_JE_X_TTRIS+4))>>4)&0xFFF;}
+  }
+  Mark_Rows_TTRIS(OU_SUIS_JE_Y_TTRIS,OU_SUIS_JE_Y_TTRIS+4);
   Scores_TTRIS=(OU_SUIS_JE_Y_TTRIS<9)?Scores_TTRIS+2:Scores_TTRIS+1;
   yy_TTRIS=0;
   xx_TTRIS=0;
@@ -242,10 +282,11 @@ if (JOY_left_pressed()) {
   }
 if ((JOY_right_pressed()==0)&&(JOY_left_pressed()==0)) {LONG_PRESS_X_TTRIS=0;PSEUDO_RND_TTRIS();}
 
+// a press sampled during the line clear is still pending here and rotates the new piece
+if ((Ripple_filter_TTRIS==1)) {CHECK_if_Rot_Ok_TTRIS(Rot_TTRIS);Ripple_filter_TTRIS=2;}
 if (JOY_act_released()) {
   if ((OU_SUIS_JE_X_ENGAGED_TTRIS==0)&&(OU_SUIS_JE_Y_ENGAGED_TTRIS==0)) {Ripple_filter_TTRIS=0;}
   }
-if ((Ripple_filter_TTRIS==1)) {CHECK_if_Rot_Ok_TTRIS(Rot_TTRIS);Ripple_filter_TTRIS=2;}
 if (OU_SUIS_JE_Y_ENGAGED_TTRIS==0){
   DROP_TRIG_TTRIS--;
   if (DROP_TRIG_TTRIS==0) {DEPLACEMENT_YY_TTRIS=1;DROP_TRIG_TTRIS=Level_Speed_ADJ_TTRIS;}
@@ -255,6 +296,16 @@ if (DROP_SPEED_TTRIS>0) {
   }else{
     DROP_SPEED_TTRIS=Level_Speed_ADJ_TTRIS;
     }
+if (JOY_up_pressed()) {
+  if ((HARD_DROP_TTRIS==0)&&(OU_SUIS_JE_X_ENGAGED_TTRIS==0)) {
+    yy_TTRIS=GHOST_YY_TTRIS;
+    DEPLACEMENT_YY_TTRIS=1;
+    DROP_SPEED_TTRIS=0;
+    }
+  HARD_DROP_TTRIS=1;
+  }else{
+    HARD_DROP_TTRIS=0;
+    }
 if (JOY_down_pressed()) {
   
 //ajouter cest 2 ligne
@@ -277,33 +328,17 @@ if (Level_TTRIS<21) {Level_Speed_ADJ_TTRIS=map(Level_TTRIS,0,20,11,1);}
 }
 
 uint8_t End_Play_TTRIS(void){
-for (uint8_t t=0;t<12;t++){
-if (GRID_STAT_TTRIS(t,1)==1) {return 1;}
-}
-return 0;
+return (Grid_TTRIS[1]!=0);
 }
 
 void DELETE_LINE_TTRIS(void){
-uint8_t LOOP,SCAN_Line,ADDs_Block,OK_DELETE=0;
-uint8_t LINE_MEM[19]={0}; 
+uint8_t LOOP;
 uint8_t Nb_of_Line_temp=0;
 for (LOOP=0;LOOP<19;LOOP++){
-ADDs_Block=1;
-for (SCAN_Line=0;SCAN_Line<12;SCAN_Line++){
-if (GRID_STAT_TTRIS(SCAN_Line,LOOP)==0) {ADDs_Block=0;}
-}
-if (ADDs_Block) {
-  LINE_MEM[LOOP]=1;
-  OK_DELETE=1;
-  }
-}
-if (OK_DELETE==1) {
-  FLASH_LINE_TTRIS(&LINE_MEM[0]);
-  Clean_Grid_TTRIS(&LINE_MEM[0]);
-  }
-for (LOOP=0;LOOP<19;LOOP++){
-if (LINE_MEM[LOOP]==1) {Nb_of_Line_temp++;}
+LINE_MEM_TTRIS[LOOP]=(Grid_TTRIS[LOOP]==0xFFF);
+Nb_of_Line_temp+=LINE_MEM_TTRIS[LOOP];
 }
+if (Nb_of_Line_temp) {CLEAR_TIMER_TTRIS=10*CLEAR_PHASE_TTRIS;}
 Nb_of_line_F_TTRIS=Nb_of_line_F_TTRIS+Nb_of_Line_temp;
 Scores_TTRIS=(Scores_TTRIS+Calcul_of_Score_TTRIS(Nb_of_Line_temp));
 }
@@ -319,78 +354,84 @@ switch(Tmp_TTRIS){
 }
 }
 
-void FLASH_LINE_TTRIS(uint8_t *PASS_LINE){
-uint8_t LOOP;
-for (LOOP=0;LOOP<5;LOOP++){
-PAINT_LINE_TTRIS(1,&PASS_LINE[0]);
-Tiny_Flip_TTRIS(82);
-
-PAINT_LINE_TTRIS(0,&PASS_LINE[0]);
-Tiny_Flip_TTRIS(82);
+// one frame of the line clear animation, the lines flash 5 times and are removed
+void Clear_Step_TTRIS(void){
+CLEAR_TIMER_TTRIS--;
+if ((CLEAR_TIMER_TTRIS%CLEAR_PHASE_TTRIS)!=0) return;
+if (CLEAR_TIMER_TTRIS) {
+  PAINT_LINE_TTRIS(((CLEAR_TIMER_TTRIS/CLEAR_PHASE_TTRIS)&1)==0,&LINE_MEM_TTRIS[0]);
+  }else{
+  Clean_Grid_TTRIS(&LINE_MEM_TTRIS[0]);
+  SWEEP_TTRIS=0;
+  }
 }
-SND_TTRIS(5);
+
+// spend the rest of the frame on the line clear sweep, or just wait
+void Frame_Wait_TTRIS(void){
+uint16_t T=FRAME_DLY_TTRIS*1000;
+while ((SWEEP_TTRIS<126)&&(T>=510)){
+  JOY_sound(SWEEP_TTRIS*2,1);
+  T-=(255-(SWEEP_TTRIS*2))*2;
+  SWEEP_TTRIS++;
+  }
+JOY_DLY_us(T);
 }
 
 void PAINT_LINE_TTRIS(uint8_t VISIBLE,uint8_t *PASS_LINE){
-uint8_t LOOP,SCAN_Line;
+uint8_t LOOP;
 for (LOOP=0;LOOP<19;LOOP++){
- if (PASS_LINE[LOOP]==1){
-for (SCAN_Line=0;SCAN_Line<12;SCAN_Line++){ 
-CHANGE_GRID_STAT_TTRIS(SCAN_Line,LOOP,VISIBLE);
-}}}}
+ if (PASS_LINE[LOOP]==1){Grid_TTRIS[LOOP]=(VISIBLE)?0xFFF:0;Mark_Rows_TTRIS(LOOP,LOOP);}
+}}
 
+// move the remaining rows down over the deleted lines, row 0 is never copied
 void Clean_Grid_TTRIS(uint8_t *PASS_LINE){
 uint8_t GRID_2=18,GRID_1=18;
-uint8_t x;
-  while(1){
-    if (PASS_LINE[GRID_1]==1) {GRID_2=GRID_1;GRID_2=(GRID_2>0)?GRID_2-1:0;break;}
-    GRID_1=(GRID_1>0)?GRID_1-1:0;}
-while(1){
-  while(1){   
-    if (PASS_LINE[GRID_2]==1) {GRID_2=(GRID_2>0)?GRID_2-1:0;}else{break;}
-          } 
- for(x=0;x<12;x++){
-CHANGE_GRID_STAT_TTRIS(x,GRID_1,(GRID_2>0)?GRID_STAT_TTRIS(x,GRID_2):0);
- }
-GRID_1=(GRID_1>0)?GRID_1-1:0;
-GRID_2=(GRID_2>0)?GRID_2-1:0;
-if (GRID_1==0) {break;}
-}}
+uint8_t Low=18;
+while((Low>0)&&(PASS_LINE[Low]==0)){Low--;}
+while(GRID_1>0){
+  while((GRID_2>0)&&(PASS_LINE[GRID_2]==1)){GRID_2--;}
+  Grid_TTRIS[GRID_1]=(GRID_2>0)?Grid_TTRIS[GRID_2]:0;
+  GRID_1--;
+  GRID_2=(GRID_2>0)?GRID_2-1:0;
+}
+Mark_Rows_TTRIS(0,Low);
+}
 
 uint8_t CHECK_if_Rot_Ok_TTRIS(uint8_t *Rot_TTRIS){
 uint8_t Mem_rot=*Rot_TTRIS;
 Ou_suis_Je_TTRIS(xx_TTRIS,yy_TTRIS);
 *Rot_TTRIS=(*Rot_TTRIS<PIECEs_rot_TTRIS)?*Rot_TTRIS+1:0;
 rotate_Matrix_TTRIS(*Rot_TTRIS);
-
-
-if ((Check_collision_x_TTRIS(OU_SUIS_JE_X_ENGAGED_TTRIS)||(Check_collision_y_TTRIS(OU_SUIS_JE_Y_ENGAGED_TTRIS)))!=0) {
-  *Rot_TTRIS=Mem_rot;
-  rotate_Matrix_TTRIS(*Rot_TTRIS);
-  return 1;
-  }
-SND_TTRIS(0);
-return 0;
+for (uint8_t t=0;t<5;t++){
+int8_t KX=Kick_TTRIS[t][0],KY=Kick_TTRIS[t][1];
+if ((Check_collision_TTRIS(KX+OU_SUIS_JE_X_ENGAGED_TTRIS,KY)||Check_collision_TTRIS(KX,KY+OU_SUIS_JE_Y_ENGAGED_TTRIS))==0) {
+  Mark_Box_TTRIS(xx_TTRIS,yy_TTRIS);
+  Mark_Box_TTRIS(xx_TTRIS,GHOST_YY_TTRIS);
+  xx_TTRIS+=KX*3;
+  yy_TTRIS+=KY*3;
+  Ghost_TTRIS();
+  SND_TTRIS(0);
+  return 0;
+  }}
+*Rot_TTRIS=Mem_rot;
+rotate_Matrix_TTRIS(*Rot_TTRIS);
+return 1;
 }
 
 uint8_t Check_collision_x_TTRIS(int8_t x_Axe){
-uint8_t x,y;
-for (y=0;y<5;y++){
-for (x=0;x<5;x++){
-if (Piece_Mat2_TTRIS[x][y]==1) {
-  if (GRID_STAT_TTRIS((x+OU_SUIS_JE_X_TTRIS)+x_Axe,y+OU_SUIS_JE_Y_TTRIS)) {return 1;}
-  } 
-  }}
-return 0; 
+return Check_collision_TTRIS(x_Axe,0);
 }
 
 uint8_t Check_collision_y_TTRIS(int8_t y_Axe){
-uint8_t x,y;
-for (y=0;y<5;y++){
-for (x=0;x<5;x++){
-if (Piece_Mat2_TTRIS[x][y]==1) {
-  if (GRID_STAT_TTRIS(x+OU_SUIS_JE_X_TTRIS,(y+OU_SUIS_JE_Y_TTRIS)+y_Axe)) {return 1;}} 
-  }}
+return Check_collision_TTRIS(0,y_Axe);
+}
+
+// piece rows against well rows, columns 0..11 of the well are bits 4..15
+uint8_t Check_collision_TTRIS(int8_t x_Axe,int8_t y_Axe){
+uint8_t Shift=OU_SUIS_JE_X_TTRIS+x_Axe+4;
+for (uint8_t y=0;y<5;y++){
+if (Row_Mask_TTRIS(OU_SUIS_JE_Y_TTRIS+y+y_Axe)&((uint32_t)Piece_Rows_TTRIS[y]<<Shift)) {return 1;}
+}
 return 0; 
 }
 
@@ -409,7 +450,8 @@ DEPLACEMENT_YY_TTRIS=0;
 LONG_PRESS_X_TTRIS=0;
 Ripple_filter_TTRIS=0;
 DROP_BREAK_TTRIS=6;
-Tiny_Flip_TTRIS(82); //add line for refresh screen at drop
+Mark_Piece_TTRIS();
+Flush_TTRIS(); //add line for refresh screen at drop
 }else{DROP_BREAK_TTRIS=0;}
 if (DROP_SPEED_TTRIS==0){
 if (DEPLACEMENT_YY_TTRIS==-1) {yy_TTRIS--;}
@@ -451,45 +493,15 @@ switch(Piece_){
 }}
 
 void rotate_Matrix_TTRIS(uint8_t ROT){
-uint8_t a_=0,b_=0;
-for (uint8_t y=0;y<5;y++){
-for (uint8_t x=0;x<5;x++){
-switch(ROT){
-  case 0:a_=x,b_=y;break;
-  case 1:a_=4-y,b_=x;break;
-  case 2:a_=4-x,b_=4-y;break;
-  case 3:a_=y,b_=4-x;break;
-  default:break;
+const uint8_t *Rot=&Rot_TTRIS[((PIECEs_TTRIS<<2)+ROT)*5];
+for (uint8_t y=0;y<5;y++){Piece_Rows_TTRIS[y]=Rot[y];}
 }
-Piece_Mat2_TTRIS[a_][b_]=Scan_Piece_Matrix_TTRIS(x,y+(PIECEs_TTRIS*5));
-}}}
 
-uint8_t Scan_Piece_Matrix_TTRIS(int8_t x_Mat,int8_t y_Mat){
-uint8_t Result=(0b10000000>>x_Mat)&(Pieces_TTRIS[y_Mat]);
-if (Result) {return 1;}else{return 0;}
-return 0;
-}
-
-uint8_t GRID_STAT_TTRIS(int8_t X_SCAN,int8_t Y_SCAN){
+// well row with walls, above the well is free, below the well is solid
+uint32_t Row_Mask_TTRIS(int8_t Y_SCAN){
 if (Y_SCAN<0) return 0;
-if ((X_SCAN<0)||(X_SCAN>11)) {return 1;}
-if (Y_SCAN>18) {return 1;}
-uint8_t Y_VAR_SELECT=Y_SCAN>>3;
-uint8_t Y_VAR_DECALAGE=RecupeDecalageY_TTRIS(Y_SCAN);
-uint8_t COMP_BYTE_DECALAGE = (0b10000000>>Y_VAR_DECALAGE);
-if ((COMP_BYTE_DECALAGE&Grid_TTRIS[X_SCAN][Y_VAR_SELECT])==0) {return 0;}else{return 1;}
-return 0;
-}
-
-uint8_t CHANGE_GRID_STAT_TTRIS(int8_t X_SCAN,int8_t Y_SCAN,uint8_t VALUE){
-if ((X_SCAN<0)||(X_SCAN>11)) return 0;
-if ((Y_SCAN<0)||(Y_SCAN>18)) return 0;
-uint8_t Y_VAR_SELECT=Y_SCAN>>3;
-uint8_t Y_VAR_DECALAGE=RecupeDecalageY_TTRIS(Y_SCAN);
-uint8_t COMP_BYTE_DECALAGE = (0b10000000>>Y_VAR_DECALAGE);
-if (VALUE) {Grid_TTRIS[X_SCAN][Y_VAR_SELECT]=COMP_BYTE_DECALAGE|Grid_TTRIS[X_SCAN][Y_VAR_SELECT];}else{
-Grid_TTRIS[X_SCAN][Y_VAR_SELECT]=(0xff-COMP_BYTE_DECALAGE)&Grid_TTRIS[X_SCAN][Y_VAR_SELECT];}
-return 0;
+if (Y_SCAN>18) return 0xFFFFFFFF;
+return ((uint32_t)Grid_TTRIS[Y_SCAN]<<4)|0xFFFF000F;
 }
 
 uint8_t blitzSprite_TTRIS(int8_t xPos,int8_t yPos,uint8_t xPASS,uint8_t yPASS,uint8_t FRAME,const uint8_t *SPRITES){
@@ -516,21 +528,90 @@ return (H_Grid_TTTRIS[xPASS-46]);
 }
 
 uint8_t Recupe_TTRIS(uint8_t xPASS,uint8_t yPASS){
-uint8_t BYTE_TTRIS=0;
-uint8_t x=0;
-for (uint8_t y=MEM_TTTRIS[(yPASS<<1)];y<MEM_TTTRIS[(yPASS<<1)+1];y++){
 if ((xPASS>45)&&(xPASS<82)){
-  x=H_grid_Scan_TTRIS(xPASS);
-  }else{
-    return 
+  return RECUPE_BACKGROUND_TTRIS(xPASS,yPASS)|Field_TTRIS[yPASS][xPASS-46]|DropPiece_TTRIS(xPASS,yPASS)|GhostPiece_TTRIS(xPASS,yPASS);
+  }
+return 
     (RECUPE_BACKGROUND_TTRIS(xPASS,yPASS)|
     NEXT_BLOCK_TTRIS(xPASS,yPASS)|
     recupe_Nb_of_line_TTRIS(xPASS,yPASS)|
     recupe_SCORES_TTRIS(xPASS,yPASS)|
-    recupe_LEVEL_TTRIS(xPASS,yPASS));}
-if (GRID_STAT_TTRIS(x,y)==1) {BYTE_TTRIS=BYTE_TTRIS|blitzSprite_TTRIS(46+(x*3),5+(y*3),xPASS,yPASS,0,tinyblock_TTTRIS);}
+    recupe_LEVEL_TTRIS(xPASS,yPASS));
 }
-return RECUPE_BACKGROUND_TTRIS(xPASS,yPASS)|BYTE_TTRIS|DropPiece_TTRIS(xPASS,yPASS);
+
+// rasterise the locked blocks of one page into the playfield image
+void Raster_Page_TTRIS(uint8_t yPASS){
+for (uint8_t xPASS=46;xPASS<82;xPASS++){
+uint8_t BYTE_TTRIS=0;
+uint8_t x=H_grid_Scan_TTRIS(xPASS);
+for (uint8_t y=MEM_TTTRIS[(yPASS<<1)];y<MEM_TTTRIS[(yPASS<<1)+1];y++){
+if ((Grid_TTRIS[y]>>x)&1) {BYTE_TTRIS=BYTE_TTRIS|blitzSprite_TTRIS(46+(x*3),5+(y*3),xPASS,yPASS,0,tinyblock_TTTRIS);}
+}
+Field_TTRIS[yPASS][xPASS-46]=BYTE_TTRIS;
+}}
+
+// grid rows Y0..Y1 changed, rasterise their pages again and push them
+void Mark_Rows_TTRIS(int8_t Y0,int8_t Y1){
+if (Y0<0) {Y0=0;}
+if (Y1>18) {Y1=18;}
+if (Y0>Y1) return;
+for (uint8_t y=(5+(Y0*3))>>3;y<=((7+(Y1*3))>>3);y++){Field_Dirty_TTRIS|=(1<<y);}
+Mark_Span_TTRIS(46,81,5+(Y0*3),7+(Y1*3));
+}
+
+// pixel rectangle of the playfield to push on the next flush
+void Mark_Span_TTRIS(int8_t X0,int8_t X1,int8_t Y0,int8_t Y1){
+if (X0<46) {X0=46;}
+if (X1>81) {X1=81;}
+if (Y0<0) {Y0=0;}
+if (Y1>63) {Y1=63;}
+if ((X0>X1)||(Y0>Y1)) return;
+for (uint8_t y=Y0>>3;y<=(Y1>>3);y++){
+if (X0<Span_L_TTRIS[y]) {Span_L_TTRIS[y]=X0;}
+if (X1>Span_R_TTRIS[y]) {Span_R_TTRIS[y]=X1;}
+}}
+
+// falling piece and ghost boxes where they were last drawn and where they are now
+void Mark_Piece_TTRIS(void){
+if ((Drawn_xx_TTRIS!=xx_TTRIS)||(Drawn_yy_TTRIS!=yy_TTRIS)) {
+Mark_Box_TTRIS(Drawn_xx_TTRIS,Drawn_yy_TTRIS);
+Mark_Box_TTRIS(xx_TTRIS,yy_TTRIS);
+}
+if ((Drawn_xx_TTRIS!=xx_TTRIS)||(Drawn_gy_TTRIS!=GHOST_YY_TTRIS)) {
+Mark_Box_TTRIS(Drawn_xx_TTRIS,Drawn_gy_TTRIS);
+Mark_Box_TTRIS(xx_TTRIS,GHOST_YY_TTRIS);
+}
+Drawn_xx_TTRIS=xx_TTRIS;
+Drawn_yy_TTRIS=yy_TTRIS;
+Drawn_gy_TTRIS=GHOST_YY_TTRIS;
+}
+
+// 5x5 piece matrix at piece position X,Y
+void Mark_Box_TTRIS(int8_t X,int8_t Y){
+Mark_Span_TTRIS(X,X+14,Y-5,Y+14);
+}
+
+// landing position of the falling piece, the piece rows are dropped against the well rows
+void Ghost_TTRIS(void){
+uint8_t d=0;
+Ou_suis_Je_TTRIS(xx_TTRIS,yy_TTRIS);
+while ((Check_collision_TTRIS(0,d+1)|Check_collision_TTRIS(OU_SUIS_JE_X_ENGAGED_TTRIS,d+1))==0) {d++;}
+GHOST_YY_TTRIS=((OU_SUIS_JE_Y_TTRIS+d)*3)+5;
+}
+
+// push the marked column spans of the playfield to the OLED
+void Flush_TTRIS(void){
+for (uint8_t y=0;y<8;y++){
+if (Field_Dirty_TTRIS&(1<<y)) {Raster_Page_TTRIS(y);}
+if (Span_L_TTRIS[y]<=Span_R_TTRIS[y]) {
+JOY_OLED_data_start_at(Span_L_TTRIS[y],y);
+for (uint8_t x=Span_L_TTRIS[y];x<=Span_R_TTRIS[y];x++){JOY_OLED_send(Recupe_TTRIS(x,y));}
+JOY_OLED_end();
+}
+Span_L_TTRIS[y]=0xFF;
+Span_R_TTRIS[y]=0;
+}
+Field_Dirty_TTRIS=0;
 }
 
 uint8_t NEXT_BLOCK_TTRIS(uint8_t xPASS,uint8_t yPASS){
@@ -550,7 +631,7 @@ switch(PIECEs_TTRIS_PREVIEW){
 }
 for (uint8_t y=0;y<5;y++){
 for (uint8_t x=0;x<5;x++){
-if (Scan_Piece_Matrix_TTRIS(x,y+(PIECEs_TTRIS_PREVIEW*5))==1) {Byte_Mem|=blitzSprite_TTRIS(92+(x*2)+x_add,(27+(y*2))-5+y_add,xPASS,yPASS,0,tiny_PREVIEW_block_TTTRIS);}
+if ((Rot_TTRIS[(PIECEs_TTRIS_PREVIEW*20)+y]>>x)&1) {Byte_Mem|=blitzSprite_TTRIS(92+(x*2)+x_add,(27+(y*2))-5+y_add,xPASS,yPASS,0,tiny_PREVIEW_block_TTTRIS);}
 }}
 return Byte_Mem;
 }
@@ -558,14 +639,24 @@ return 0;
 }
 
 uint8_t RECUPE_BACKGROUND_TTRIS(uint8_t xPASS,uint8_t yPASS){
-return (BACKGROUND_TTRIS[xPASS+(yPASS*128)]);
+return PACK_get(&BACKGROUND_CURSOR_TTRIS,xPASS,yPASS);
 }
 
 uint8_t DropPiece_TTRIS(uint8_t xPASS,uint8_t yPASS){
 uint8_t Byte_Mem=0;
 for (uint8_t y=0;y<5;y++){
 for (uint8_t x=0;x<5;x++){
-if (Piece_Mat2_TTRIS[x][y]==1) {Byte_Mem|=blitzSprite_TTRIS(xx_TTRIS+(x*3),(yy_TTRIS+(y*3))-5,xPASS,yPASS,0,tinyblock2_TTTRIS);}
+if ((Piece_Rows_TTRIS[y]>>x)&1) {Byte_Mem|=blitzSprite_TTRIS(xx_TTRIS+(x*3),(yy_TTRIS+(y*3))-5,xPASS,yPASS,0,tinyblock2_TTTRIS);}
+}}
+return Byte_Mem;
+}
+
+uint8_t GhostPiece_TTRIS(uint8_t xPASS,uint8_t yPASS){
+uint8_t Byte_Mem=0;
+if (GHOST_YY_TTRIS==yy_TTRIS) return 0;
+for (uint8_t y=0;y<5;y++){
+for (uint8_t x=0;x<5;x++){
+if ((Piece_Rows_TTRIS[y]>>x)&1) {Byte_Mem|=blitzSprite_TTRIS(xx_TTRIS+(x*3),(GHOST_YY_TTRIS+(y*3))-5,xPASS,yPASS,0,tinyghost_TTTRIS);}
 }}
 return Byte_Mem;
 }
@@ -586,10 +677,18 @@ return (Valeur-((Valeur>>3)<<3));
 void Tiny_Flip_TTRIS(uint8_t HR_TTRIS){
 uint8_t y,x; 
 for (y = 0; y < 8; y++){ 
+if (Field_Dirty_TTRIS&(1<<y)) {Raster_Page_TTRIS(y);}
+Span_L_TTRIS[y]=0xFF;
+Span_R_TTRIS[y]=0;
 JOY_OLED_data_start(y);
 for (x = 0; x < HR_TTRIS; x++){JOY_OLED_send(Recupe_TTRIS(x,y));}
 JOY_OLED_end();
-}}
+}
+Field_Dirty_TTRIS=0;
+Drawn_xx_TTRIS=xx_TTRIS;
+Drawn_yy_TTRIS=yy_TTRIS;
+Drawn_gy_TTRIS=GHOST_YY_TTRIS;
+}
 
 void Flip_intro_TTRIS(uint8_t *TIMER1){
 uint8_t y,x; 
@@ -668,12 +767,15 @@ return
 }
 
 void INIT_ALL_VAR_TTRIS(void){
-for(uint8_t y=0;y<3;y++){
-for(uint8_t x=0;x<12;x++){
-Grid_TTRIS[x][y]=0;}}
+for(uint8_t y=0;y<19;y++){
+Grid_TTRIS[y]=0;}
+Field_Dirty_TTRIS=0xFF;
+CLEAR_TIMER_TTRIS=0;
+SPAWN_TTRIS=0;
+SWEEP_TTRIS=126;
+HARD_DROP_TTRIS=1;
 for(uint8_t y=0;y<5;y++){
-for(uint8_t x=0;x<5;x++){
-Piece_Mat2_TTRIS[x][y]=0;}}
+Piece_Rows_TTRIS[y]=0;}
 LONG_PRESS_X_TTRIS=0;
 DOWN_DESACTIVE_TTRIS=0;
 DROP_SPEED_TTRIS=0;
@@ -694,77 +796,14 @@ DEPLACEMENT_XX_TTRIS=0;
 DEPLACEMENT_YY_TTRIS=0;
 }
 
-#define Number_of_Backup 4
-
+// best score, lines and level are kept in the flash store
 void recupe_HIGHSCORE_TTRIS(void){
-/*
-uint8_t RESAVE=0;
-uint8_t t;
-
-uint8_t Level_SUM[Number_of_Backup]={0};
-uint8_t line_SUM[Number_of_Backup]={0};
-uint8_t Scores_SUM[Number_of_Backup]={0};
-
-//recupe data eeprom 
-#define Level_(tt) EEPROM.read(1+(tt*10))
-#define line_A(tt) EEPROM.read(2+(tt*10))
-#define line_B(tt) EEPROM.read(3+(tt*10))
-#define Scores_A(tt) EEPROM.read(4+(tt*10))
-#define Scores_B(tt) EEPROM.read(5+(tt*10))
-
-for (t=0;t<Number_of_Backup;t++){
-Level_SUM[t]=EEPROM.read(7+(t*10));
-line_SUM[t]=EEPROM.read(8+(t*10));
-Scores_SUM[t]=EEPROM.read(9+(t*10));
-}
-//fin
-
-//SUM check
-for (t=0;t<Number_of_Backup;t++){
-if ((checksum(Level_(t)))!=(Level_SUM[t])) {Level_SUM[t]=255;RESAVE=1;}
-if ((checksum(line_A(t))+checksum(line_B(t)))!=(line_SUM[t])) {line_SUM[t]=255;RESAVE=1;}
-if ((checksum(Scores_A(t))+checksum(Scores_B(t)))!=(Scores_SUM[t])) {Scores_SUM[t]=255;RESAVE=1;}
-}
-//SUM check fin
-
-//Get Level
-for (t=0;t<Number_of_Backup;t++){
-if (Level_SUM[t]!=255) {
-Level_TTRIS=Level_(t);
-  goto Next_2;}
-}
-goto ED;
-Next_2:;
-//get level fin
-
-//Get Lines
-for (t=0;t<Number_of_Backup;t++){
-if (line_SUM[t]!=255) {
-Nb_of_line_F_TTRIS=uint16_t (line_A(t)<<8);
-Nb_of_line_F_TTRIS|=uint16_t (line_B(t));
-goto Next_3;}
-}
-goto ED;
-Next_3:;
-//get Lines fin
-
-//Get Scores
-for (t=0;t<Number_of_Backup;t++){
-if (Scores_SUM[t]!=255) {
-Scores_TTRIS=uint16_t (Scores_A(t)<<8);
-Scores_TTRIS|=uint16_t (Scores_B(t));
-goto Next_4;}
-}
-goto ED;
-//get Scores fin
-
-ED:;
 Reset_Value_TTRIS();
-Next_4:;
-if (RESAVE) {save_HIGHSCORE_TTRIS();} //resave if sumcheck not pass
-*/
-Reset_Value_TTRIS();
-}
+if (KV_get(KV_SCORE_TTRIS)!=KV_EMPTY) {
+Scores_TTRIS=KV_get(KV_SCORE_TTRIS);
+Nb_of_line_F_TTRIS=KV_get(KV_LINES_TTRIS);
+Level_TTRIS=KV_get(KV_LEVEL_TTRIS);
+}}
 
 void Reset_Value_TTRIS(void){
 Level_TTRIS=0;
@@ -773,39 +812,14 @@ Scores_TTRIS=0;
 }
 
 void save_HIGHSCORE_TTRIS(void){
-/*
-uint8_t LEVEL_=Level_TTRIS&0xff;
-uint8_t LINE_0=(Nb_of_line_F_TTRIS>>8) & 0xFF;
-uint8_t LINE_1=Nb_of_line_F_TTRIS&0xff;
-uint8_t Scores_0=(Scores_TTRIS>>8) & 0xFF;
-uint8_t Scores_1=Scores_TTRIS&0xff;
-uint8_t t;
-for (t=0;t<Number_of_Backup;t++){
-EEPROM.write(1+(t*10),LEVEL_);
-EEPROM.write(2+(t*10),LINE_0);
-EEPROM.write(3+(t*10),LINE_1);
-EEPROM.write(4+(t*10),Scores_0);
-EEPROM.write(5+(t*10),Scores_1);
-EEPROM.write(7+(t*10),checksum(LEVEL_));
-EEPROM.write(8+(t*10),(checksum(LINE_0)+checksum(LINE_1)));
-EEPROM.write(9+(t*10),(checksum(Scores_0)+checksum(Scores_1)));
-}
-*/
+KV_set(KV_SCORE_TTRIS,Scores_TTRIS);
+KV_set(KV_LINES_TTRIS,Nb_of_line_F_TTRIS);
+KV_set(KV_LEVEL_TTRIS,Level_TTRIS);
+KV_commit();
 }
 
 void Check_NEW_RECORD(void){
-/*
-if (Scores_TTRIS>uint16_t((EEPROM.read(4)<<8)|(EEPROM.read(5)))) {
+if ((KV_get(KV_SCORE_TTRIS)==KV_EMPTY)||(Scores_TTRIS>KV_get(KV_SCORE_TTRIS))) {
 save_HIGHSCORE_TTRIS();
 }
-*/
-}
-
-uint8_t checksum(uint8_t Byte_){
-uint8_t Total_=0;
-uint8_t t=0;
-for (t=0;t<8;t++){
-if ((Byte_)&(0b00000001<<t)) {Total_++;}
-}
-return Total_;
 }
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# ===================================================================================
+# Project:   rotgen - Rotation Table Generator for Tiny Tris
+# Version:   v1.0
+# Year:      2023
+# License:   MIT License
+# ===================================================================================
+#
+# Description:
+# ------------
+# Precomputes the four rotations of every piece in Pieces_TTRIS (spritebank.h) in
+# row mask form, so that the game only has to copy 5 bytes on a rotation instead of
+# scanning the 5x5 piece matrix. The rotations are the same as the ones the former
+# rotate_Matrix_TTRIS() computed at runtime.
+#
+# Piece:      5 rows of 8 bits, column x of the 5x5 matrix is bit (7 - x)
+# Row masks:  5 bytes per rotation, column x of the 5x5 matrix is bit x
+# Table:      7 pieces x 4 rotations x 5 rows
+#
+# Operating Instructions:
+# -----------------------
+# - python rotgen.py [-h] [-n NAME] [INPUT]
+#   -h, --help                show help message and exit
+#   -n NAME, --name NAME      name of the generated C array (default: Rot_TTRIS)
+#   INPUT                     spritebank.h with Pieces_TTRIS (default: the one in
+#                             ../include)
+#
+# - Example:
+#   python rotgen.py > rotations.h
+
+
+import os
+import re
+import sys
+import argparse
+
+PIECES    = 7             # number of pieces
+SIZE      = 5             # piece matrix is SIZE x SIZE
+ROTATIONS = 4             # rotations per piece
+
+# ===================================================================================
+# Main Function
+# ===================================================================================
+
+def _main():
+    default = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include', 'spritebank.h')
+    parser = argparse.ArgumentParser(description='Rotation table generator for Tiny Tris')
+    parser.add_argument('-n', '--name', default='Rot_TTRIS', help='name of the generated C array')
+    parser.add_argument('input', nargs='?', default=default, help='spritebank.h with Pieces_TTRIS')
+    args = parser.parse_args(sys.argv[1:])
+
+    pieces = read_array(args.input, 'Pieces_TTRIS')
+    if len(pieces) != PIECES * SIZE:
+        raise SystemExit('ERROR: Pieces_TTRIS must be %d bytes, got %d' % (PIECES * SIZE, len(pieces)))
+
+    print('// piece rotations as row masks (bit x = column x), generated with tools/rotgen.py')
+    print('const uint8_t  %s[] = {' % args.name)
+    for p in range(PIECES):
+        rows = ['0x%02X' % m for r in range(ROTATIONS) for m in rotate(pieces[p * SIZE:(p + 1) * SIZE], r)]
+        print('%s%s  // %d' % (','.join(rows), ',' if p + 1 < PIECES else ' ', p))
+    print('};')
+
+# ===================================================================================
+# Rotation
+# ===================================================================================
+
+def rotate(piece, rot):
+    masks = [0] * SIZE
+    for y in range(SIZE):
+        for x in range(SIZE):
+            if not piece[y] & (0x80 >> x):
+                continue
+            a, b = [(x, y), (4 - y, x), (4 - x, 4 - y), (y, 4 - x)][rot]
+            masks[b] |= 1 << a
+    return masks
+
+# ===================================================================================
+# C Array Input
+# ===================================================================================
+
+def read_array(filename, name):
+    with open(filename) as f:
+        src = f.read()
+    m = re.search(r'\b' + re.escape(name) + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\};', src, re.S)
+    if not m:
+        raise SystemExit('ERROR: array %s not found in %s' % (name, filename))
+    body = re.sub(r'//[^\n]*', '', m.group(1))
+    return [int(v, 0) & 0xFF for v in re.findall(r'0x[0-9a-fA-F]+|0b[01]+|\d+', body)]
+
+# ===================================================================================
+
+if __name__ == "__main__":
+    _main()